@@ -0,0 +1,159 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace panel
+{
+namespace bios
+{
+/** @brief BIOS attributes the panel functions depend on. */
+enum class Attribute : uint8_t
+{
+    OS_BOOT_TYPE,
+    SYSTEM_OPERATING_MODE,
+    HMC_MANAGED,
+    HYP_SWITCH,
+    FW_BOOT_SIDE,
+    COUNT
+};
+
+static constexpr auto attributeCount = static_cast<size_t>(Attribute::COUNT);
+
+/** @brief BaseBIOSTable attribute names, indexed by Attribute. */
+static constexpr std::array<std::string_view, attributeCount> attributeNames = {
+    "pvm_os_boot_type", "pvm_system_operating_mode", "pvm_hmc_managed",
+    "hb_hyp_switch", "fw_boot_side"};
+
+/**
+ * @brief Bit mask of attributes, bit position given by Attribute.
+ */
+using AttributeMask = uint8_t;
+
+/**
+ * @brief Get the mask bit of a given attribute.
+ * @param[in] attr - Attribute.
+ * @return Mask with only the bit of the attribute set.
+ */
+constexpr AttributeMask maskOf(const Attribute attr)
+{
+    return static_cast<AttributeMask>(1 << static_cast<uint8_t>(attr));
+}
+
+/** @class AttributeTracker
+ * @brief Cache of the BIOS attributes used by the panel.
+ *
+ * BaseBIOSTable carries every BIOS attribute of the system while the panel
+ * only needs a handful of them. The tracker walks the table once, in place,
+ * picks the attributes it tracks and caches their current values so that
+ * functions like 01 and 02 can be served from memory.
+ */
+class AttributeTracker
+{
+  public:
+    /* Deleted Api's*/
+    AttributeTracker(const AttributeTracker&) = delete;
+    AttributeTracker& operator=(const AttributeTracker&) = delete;
+    AttributeTracker(AttributeTracker&&) = delete;
+
+    AttributeTracker() = default;
+    ~AttributeTracker() = default;
+
+    /**
+     * @brief Update the cache from a BaseBIOSTable.
+     *
+     * Table can be any range of (attribute name, BiosProperty) pairs, which
+     * covers both the map delivered by the PropertiesChanged signal and the
+     * array read through the Get method.
+     *
+     * @param[in] table - BaseBIOSTable.
+     * @return Mask of attributes whose value changed.
+     */
+    template <typename Table>
+    AttributeMask update(const Table& table)
+    {
+        AttributeMask changed = 0;
+        size_t found = 0;
+
+        for (const auto& [name, property] : table)
+        {
+            const auto index = lookup(name);
+            if (index == attributeCount)
+            {
+                continue;
+            }
+
+            if (const auto value =
+                    std::get_if<std::string>(&std::get<5>(property)))
+            {
+                if (values[index] != *value)
+                {
+                    values[index] = *value;
+                    changed |= maskOf(static_cast<Attribute>(index));
+                }
+            }
+
+            // No need to scan the rest of the table once all the tracked
+            // attributes are seen.
+            if (++found == attributeCount)
+            {
+                break;
+            }
+        }
+
+        populated = true;
+        return changed;
+    }
+
+    /**
+     * @brief Read BaseBIOSTable over D-Bus and update the cache.
+     * @return true if the table could be read, false otherwise.
+     */
+    bool refresh();
+
+    /**
+     * @brief Get cached value of an attribute.
+     *
+     * The cache is filled from D-Bus on first use if it has not been
+     * populated yet.
+     *
+     * @param[in] attr - Attribute.
+     * @return Current value, empty if not known.
+     */
+    const std::string& get(const Attribute attr);
+
+    /**
+     * @brief Check if the cache holds data from a BaseBIOSTable.
+     * @return true if populated, false otherwise.
+     */
+    inline bool isPopulated() const
+    {
+        return populated;
+    }
+
+  private:
+    /**
+     * @brief Get index of an attribute from its name.
+     * @param[in] name - Attribute name.
+     * @return Index of the attribute, attributeCount if not tracked.
+     */
+    static size_t lookup(std::string_view name);
+
+    /* Current values, indexed by Attribute */
+    std::array<std::string, attributeCount> values{};
+
+    /* If the values have been read from a BaseBIOSTable */
+    bool populated = false;
+};
+
+/**
+ * @brief Get the attribute tracker of the application.
+ * @return Reference to the tracker.
+ */
+AttributeTracker& attributes();
+
+} // namespace bios
+} // namespace panel
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "event_recorder.hpp"
 #include "panel_state_manager.hpp"
 #include "transport.hpp"
 
@@ -36,47 +37,67 @@ class BusHandler
     {
         iface->register_method("Display", [this](const std::string& line1,
                                                  const std::string& line2) {
+            record::recorder().record(record::EventType::DISPLAY, line1, line2);
             this->display(line1, line2);
         });
 
-        iface->register_method(
-            "TriggerPanelLampTest",
-            [this](const bool status) { this->triggerPanelLampTest(status); });
-
-        iface->register_method("toggleFunctionState",
-                               [this](const types::FunctionalityList& list) {
-                                   this->toggleFunctionState(list);
+        iface->register_method("TriggerPanelLampTest",
+                               [this](const bool status) {
+                                   record::recorder().record(
+                                       record::EventType::LAMP_TEST, status);
+                                   this->triggerPanelLampTest(status);
                                });
 
+        iface->register_method(
+            "toggleFunctionState",
+            [this](const types::FunctionalityList& list) {
+                record::recorder().record(
+                    record::EventType::TOGGLE_FUNCTION_STATE, list);
+                this->toggleFunctionState(list);
+            });
+
         iface->register_property(
             "ACFWindowActive", false,
             sdbusplus::asio::PropertyPermission::readWrite);
 
-        iface->register_method("ProcessButton",
-                               [this](int event) { this->btnRequest(event); });
+        iface->register_method("ProcessButton", [this](int event) {
+            record::recorder().record(record::EventType::PROCESS_BUTTON,
+                                      event);
+            this->btnRequest(event);
+        });
 
-        iface->register_property("OSIPLMode", false,
-                                 [this](const bool newVal, bool& oldVal) {
-                                     if (newVal != oldVal)
-                                     {
-                                         this->executor->setOSIPLMode(newVal);
-                                         oldVal = newVal;
-                                         return 1;
-                                     }
-                                     return 0;
-                                 });
+        iface->register_property(
+            "OSIPLMode", false, [this](const bool newVal, bool& oldVal) {
+                if (newVal != oldVal)
+                {
+                    record::recorder().record(record::EventType::OS_IPL_MODE,
+                                              newVal);
+                    this->executor->setOSIPLMode(newVal);
+                    oldVal = newVal;
+                    return 1;
+                }
+                return 0;
+            });
 
         iface->register_method("ExecuteFunction",
-                               [this](const types::FunctionNumber funcNum) {
-                                   return this->triggerPanelFunc(funcNum);
+                               [this](boost::asio::yield_context yield,
+                                      const types::FunctionNumber funcNum) {
+                                   record::recorder().record(
+                                       record::EventType::EXECUTE_FUNCTION,
+                                       funcNum);
+                                   return this->triggerPanelFunc(funcNum,
+                                                                 yield);
                                });
 
         iface->register_method("getEnabledFunctions", [this]() {
+            record::recorder().record(record::EventType::GET_ENABLED_FUNCTIONS);
             return this->getEnabledFunctionsList();
         });
     }
 
-  private:
+    // Handlers of the com.ibm.panel methods. Recorded calls are replayed
+    // through them.
+
     /**
      * @brief Api to display on LCD panel.
      * This api can be called over Dbus to display any content
@@ -107,18 +128,6 @@ class BusHandler
      */
     void toggleFunctionState(types::FunctionalityList list);
 
-    /* Pointer to transport class */
-    std::shared_ptr<Transport> transport;
-
-    /* Pointer to interface */
-    std::shared_ptr<sdbusplus::asio::dbus_interface> iface;
-
-    /* Pointer to state manager class */
-    std::shared_ptr<state::manager::PanelStateManager> stateManager;
-
-    /* Pointer to Executor class */
-    std::shared_ptr<Executor> executor;
-
     /**
      * @brief Api to process button request.
      *
@@ -132,9 +141,11 @@ class BusHandler
      * Method to trigger panel function from external source.
      *
      * @param[in] funcNum - Function number to execute
+     * @param[in] yield - Context of the method call coroutine.
      * @return a tuple with status(true/false) and display lines.
      */
-    types::ReturnStatus triggerPanelFunc(const types::FunctionNumber funcNum);
+    types::ReturnStatus triggerPanelFunc(const types::FunctionNumber funcNum,
+                                         boost::asio::yield_context yield);
 
     /**
      * @brief API to get list of enabled functions.
@@ -142,6 +153,19 @@ class BusHandler
      * @return List of enabled functions.
      */
     types::Binary getEnabledFunctionsList();
+
+  private:
+    /* Pointer to transport class */
+    std::shared_ptr<Transport> transport;
+
+    /* Pointer to interface */
+    std::shared_ptr<sdbusplus::asio::dbus_interface> iface;
+
+    /* Pointer to state manager class */
+    std::shared_ptr<state::manager::PanelStateManager> stateManager;
+
+    /* Pointer to Executor class */
+    std::shared_ptr<Executor> executor;
 };
 
 } // namespace panel
\ No newline at end of file
@@ -2,13 +2,27 @@
 
 #include "executor.hpp"
 #include "panel_state_manager.hpp"
+#include "signal_dispatcher.hpp"
+#include "src_record.hpp"
 #include "transport.hpp"
 
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <sdbusplus/asio/object_server.hpp>
 #include <string>
+#include <tuple>
+#include <vector>
+
 namespace panel
 {
+/**
+ * @brief Callback invoked once a class has loaded its initial state.
+ */
+using LoadedCallback = std::function<void()>;
+
 /** @class PanelPresence
  * @brief Panel presence method implementation.
  *
@@ -26,15 +40,15 @@ class PanelPresence
     /** A Constructor
      * Constructor which instantiates the PanelPresence class object.
      * @param[in] objPath - panel's dbus object path.
-     * @param[in] conn - panel sdbusplus connection object.
+     * @param[in] dispatcher - signal dispatcher to register the match with.
      * @param[in] transport - transport object to set the transport key.
      */
     PanelPresence(std::string& objPath,
-                  std::shared_ptr<sdbusplus::asio::connection> conn,
+                  std::shared_ptr<SignalDispatcher> dispatcher,
                   std::shared_ptr<Transport> transport,
                   std::shared_ptr<state::manager::PanelStateManager> state) :
         objectPath(objPath),
-        conn(conn), transport(transport), stateManager(state)
+        dispatcher(dispatcher), transport(transport), stateManager(state)
     {
     }
 
@@ -46,7 +60,7 @@ class PanelPresence
 
   private:
     std::string objectPath;
-    std::shared_ptr<sdbusplus::asio::connection> conn;
+    std::shared_ptr<SignalDispatcher> dispatcher;
     std::shared_ptr<Transport> transport;
     std::shared_ptr<state::manager::PanelStateManager> stateManager;
 
@@ -64,6 +78,8 @@ class PanelPresence
     void readBasePresentProperty(sdbusplus::message_t& msg);
 };
 
+class BootProgressCode;
+
 /** @class PELListener
  * @brief Listen to PEL logged event.
  *
@@ -82,23 +98,48 @@ class PELListener
     /**
      * @brief Constructor
      * @param[in] con - Bus connection.
+     * @param[in] dispatcher - Signal dispatcher.
      * @param[in] manager - Pointer to State manager.
      * @param[in] execute - pointer to Executor.
      * @param[in] transport - pointer to transport class.
+     * @param[in] progressCode - Progress code handler, outlives the listener.
      */
     PELListener(std::shared_ptr<sdbusplus::asio::connection> con,
+                std::shared_ptr<SignalDispatcher> dispatcher,
                 std::shared_ptr<state::manager::PanelStateManager> manager,
                 std::shared_ptr<Executor> execute,
-                std::shared_ptr<Transport>& transport) :
+                std::shared_ptr<Transport>& transport,
+                BootProgressCode& progressCode) :
         conn(con),
-        stateManager(manager), executor(execute), transport(transport)
+        dispatcher(dispatcher), stateManager(manager), executor(execute),
+        transport(transport), progressCode(progressCode)
     {
     }
 
     /**
      * @brief Api to listen for PEL addition/deletion events.
+     * PELs logged before the panel came up are read asynchronously.
+     * @param[in] onLoaded - Callback invoked once the existing PELs are read.
+     */
+    void listenPelEvents(LoadedCallback onLoaded);
+
+    /**
+     * @brief Api to process a PEL logged with severity non informational.
+     * @param[in] pelObjPath - Object path of the PEL.
+     * @param[in] resolution - Resolution of the PEL, std::nullopt if it could
+     * not be read.
+     * @param[in] eventId - Event Id of the PEL, std::nullopt if it could not
+     * be read.
      */
-    void listenPelEvents();
+    void processPelAdded(const std::string& pelObjPath,
+                         const std::optional<std::string>& resolution,
+                         const std::optional<std::string>& eventId);
+
+    /**
+     * @brief Api to process a deleted PEL.
+     * @param[in] pelObjPath - Object path of the PEL.
+     */
+    void processPelRemoved(const std::string& pelObjPath);
 
   private:
     /* Callback to listen for PEL event log */
@@ -109,15 +150,19 @@ class PELListener
 
     /**
      * @brief An Api to set panel function state based on PEL data.
-     * @param[in]pelObjPath - Object path of the PEL logged.
+     * @param[in] pelObjPath - Object path of the PEL logged.
+     * @param[in] resolution - Resolution of the PEL, std::nullopt if it could
+     * not be read.
      */
     void setPelRelatedFunctionState(
-        const sdbusplus::message::object_path& pelObjPath);
+        const std::string& pelObjPath,
+        const std::optional<std::string>& resolution);
 
     /**
      * @brief An Api to get list of PELs logged in the system.
+     * @param[in] onLoaded - Callback invoked once the list is processed.
      */
-    void getListOfExistingPels();
+    void getListOfExistingPels(LoadedCallback onLoaded);
 
     /**
      * @brief An Api to filter PELs of desired severity and eventId.
@@ -128,6 +173,9 @@ class PELListener
     /* Dbus connection */
     std::shared_ptr<sdbusplus::asio::connection> conn;
 
+    /* Signal dispatcher */
+    std::shared_ptr<SignalDispatcher> dispatcher;
+
     /* state manager */
     std::shared_ptr<state::manager::PanelStateManager> stateManager;
 
@@ -137,12 +185,19 @@ class PELListener
     /* pointer to Transport class*/
     std::shared_ptr<Transport> transport;
 
+    /* Progress code handler, a terminating SRC replaces its pending code */
+    BootProgressCode& progressCode;
+
     /* Check if respective functions are enabled */
     bool functionStateEnabled = false;
 
     /* Store the last logged PEL with required severity */
     std::string lastPelObjPath;
 
+    /* If a PEL was received over signal, making the existing PEL list read
+     * at start up stale. */
+    bool pelSignalled = false;
+
 }; // class PEL Listener
 
 /**
@@ -159,15 +214,17 @@ class BootProgressCode
 
     /**
      * @brief Constructor.
+     * @param[in] io - Boost asio io_context object pointer.
      * @param[in] transport - pointer to transport class.
-     * @param[in] con - Bus connection.
+     * @param[in] dispatcher - Signal dispatcher.
      * @param[in] execute - pointer to Executor.
      */
-    BootProgressCode(std::shared_ptr<Transport> transport,
-                     std::shared_ptr<sdbusplus::asio::connection> con,
+    BootProgressCode(std::shared_ptr<boost::asio::io_context>& io,
+                     std::shared_ptr<Transport> transport,
+                     std::shared_ptr<SignalDispatcher> dispatcher,
                      std::shared_ptr<Executor> execute) :
         transport(transport),
-        conn(con), executor(execute)
+        dispatcher(dispatcher), executor(execute), dwellTimer(*io)
     {
     }
 
@@ -176,7 +233,48 @@ class BootProgressCode
      */
     void listenProgressCode();
 
+    /* Progress code and the hexwords sent with it */
+    using PostCode = std::tuple<uint64_t, std::vector<types::Byte>>;
+
+    /**
+     * @brief Api to display and store a progress code.
+     * @param[in] postCode - Progress code received.
+     */
+    void processProgressCode(const PostCode& postCode);
+
+    /**
+     * @brief Get the progress code counts of the current boot, or of the
+     * last boot once it has completed.
+     * @return (progress codes received, progress codes displayed).
+     */
+    inline types::ProgressCodeStatistics getStatistics() const
+    {
+        return std::make_tuple(receivedCount, displayedCount);
+    }
+
+    /**
+     * @brief Api to drop the progress code held back by the dwell.
+     * Called before something else is shown on the progress layer, so that
+     * the end of the dwell does not overwrite it.
+     */
+    void cancelPending();
+
   private:
+    /**
+     * @brief Api to display a progress code.
+     * Codes received within the dwell of the displayed code are held back,
+     * the newest of them is displayed once the dwell ends.
+     *
+     * @param[in] srcRecord - Progress code.
+     */
+    void displayProgressCode(const SrcRecord& srcRecord);
+
+    /**
+     * @brief Api to write a progress code to the display.
+     * @param[in] srcRecord - Progress code.
+     */
+    void showProgressCode(const SrcRecord& srcRecord);
+
     /**
      * @brief Callback handler.
      * An Api to handle callback in case of progress code property change.
@@ -187,12 +285,30 @@ class BootProgressCode
     /*Transport Class object */
     std::shared_ptr<Transport> transport;
 
-    /* D-Bus connection. */
-    std::shared_ptr<sdbusplus::asio::connection> conn;
+    /* Signal dispatcher */
+    std::shared_ptr<SignalDispatcher> dispatcher;
 
     /* Executor */
     std::shared_ptr<Executor> executor;
 
+    /* Timer ending the dwell of the displayed progress code */
+    boost::asio::steady_timer dwellTimer;
+
+    /* Time the displayed progress code was shown */
+    std::chrono::steady_clock::time_point shownAt;
+
+    /* Newest progress code received within the dwell */
+    std::optional<SrcRecord> pendingCode;
+
+    /* Progress codes received in the current boot */
+    uint64_t receivedCount = 0;
+
+    /* Progress codes displayed in the current boot */
+    uint64_t displayedCount = 0;
+
+    /* If the boot ended, the counts restart with the next progress code */
+    bool isBootComplete = false;
+
 }; // class BootProgressCode
 
 /**
@@ -211,13 +327,29 @@ class SystemStatus
 
     /**
      * @brief Constructor.
+     * Registers for the system state signals and issues the reads of the
+     * current system state, all of them in parallel.
+     *
      * @param[in] con - Bus connection.
+     * @param[in] dispatcher - Signal dispatcher.
      * @param[in] manager - Pointer to state manager.
+     * @param[in] onLoaded - Callback invoked once all the reads complete.
      */
     SystemStatus(std::shared_ptr<sdbusplus::asio::connection>& con,
-                 std::shared_ptr<state::manager::PanelStateManager>& manager);
+                 std::shared_ptr<SignalDispatcher>& dispatcher,
+                 std::shared_ptr<state::manager::PanelStateManager>& manager,
+                 LoadedCallback onLoaded);
 
   private:
+    /** @brief System state read at start up, one bit each. */
+    enum InitialState : uint8_t
+    {
+        BMC_STATE = 0x01,
+        POWER_STATE = 0x02,
+        BOOT_PROGRESS_STATE = 0x04,
+        OPERATING_MODE = 0x08
+    };
+
     /**
      * @brief Listen for BMC state.
      * An api to register call back for BMC state property changed.
@@ -273,12 +405,20 @@ class SystemStatus
     void rebootPolicyStateCallback(sdbusplus::message_t& msg);
 
     /**
-     * @brief Api to initialize system operating mode.
+     * @brief Api to load the initial system state.
      *
-     * The API sets the state manager's system state based on the operating mode
-     * at the time of panel coming up.
+     * Reads BMC state, power state, boot progress and system operating mode
+     * asynchronously and sets the state manager's system state as each reply
+     * arrives. A reply is dropped if the same state has already been received
+     * over signal, as the reply would be stale.
      */
-    void initSystemOperatingMode();
+    void loadInitialState();
+
+    /**
+     * @brief Api to account for a completed initial read.
+     * Invokes the loaded callback once all the reads are complete.
+     */
+    void initialReadDone();
 
     /**
      * @brief BIOS attribute change callback.
@@ -292,6 +432,9 @@ class SystemStatus
     /* D-Bus connection. */
     std::shared_ptr<sdbusplus::asio::connection> conn;
 
+    /* Signal dispatcher */
+    std::shared_ptr<SignalDispatcher> dispatcher;
+
     /* state manager */
     std::shared_ptr<state::manager::PanelStateManager> stateManager;
 
@@ -300,5 +443,14 @@ class SystemStatus
 
     /* Member to store reboot policy */
     bool rebootPolicy;
+
+    /* Callback invoked once the initial state is loaded */
+    LoadedCallback onLoaded;
+
+    /* Number of initial reads yet to complete */
+    uint8_t pendingReads = 0;
+
+    /* Bit mask of InitialState already received over signal */
+    uint8_t signalled = 0;
 };
 } // namespace panel
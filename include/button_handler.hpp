@@ -5,7 +5,9 @@
 
 #include <linux/input.h>
 
+#include <boost/asio/steady_timer.hpp>
 #include <sdbusplus/asio/connection.hpp>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -39,8 +41,11 @@ class ButtonHandler
      * @param[in] io - Boost asio io_context object pointer.
      * @param[in] transport - Transport Object to call transport functions.
      * @param[in] stateManager - State manager object to call
-     * @param[in] i2cBusPath - i2c bus path to communicate with panel.
      * increment/decrement/execute methods.
+     * @param[in] i2cBusPath - i2c bus path to communicate with panel.
+     *
+     * No device is opened for an empty path, events are then only received
+     * through processButtonEvents.
      */
     ButtonHandler(
         const std::string& path, std::shared_ptr<boost::asio::io_context>& io,
@@ -48,6 +53,11 @@ class ButtonHandler
         std::shared_ptr<state::manager::PanelStateManager> stateManager,
         const std::string& i2cBusPath);
 
+    /** @brief Api to process a batch of input events read from the device.
+     *  @param[in] events - Input events, in the order read.
+     */
+    void processButtonEvents(std::span<const input_event> events);
+
   private:
     /** @brief Api to perform async read operation on the device path.
      */
@@ -60,6 +70,11 @@ class ButtonHandler
     void processInputEvent(const boost::system::error_code& ec,
                            size_t bytesTransferred);
 
+    /** @brief Api to apply the increment/decrement presses received so far
+     * as a single navigation.
+     */
+    void applyPendingNavigation();
+
     /* Device path*/
     std::string devicePath;
 
@@ -86,5 +101,14 @@ class ButtonHandler
     /* file descriptor */
     int fd = -1;
 
+    /* Timer to collect the increment/decrement presses to apply together */
+    boost::asio::steady_timer debounceTimer;
+
+    /* If the debounce timer is running */
+    bool isDebounceTimerArmed = false;
+
+    /* Net number of increment(+)/decrement(-) presses not yet applied */
+    int pendingOffset = 0;
+
 }; // class ButtonHandler
 } // namespace panel
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace panel
+{
+/** @brief Callout of a PEL, rendered as displayed by functions 14 to 19.
+ *
+ * Line 1 holds the priority and the procedure or part number, line 2 the
+ * location code. Both are padded with spaces to the panel line length.
+ */
+struct CallOut
+{
+    /** @brief Length of a panel line. */
+    static constexpr size_t lineLength = 16;
+
+    /** @brief Maximum number of callouts displayed, one per function. */
+    static constexpr size_t maxCallOuts = 6;
+
+    /** @brief A line of the panel. */
+    using Line = std::array<char, lineLength>;
+
+    // Priority and procedure or part number.
+    Line line1{};
+
+    // Location code.
+    Line line2{};
+
+    /**
+     * @brief Get line 1.
+     * @return View of line 1.
+     */
+    constexpr std::string_view getLine1() const
+    {
+        return std::string_view(line1.data(), line1.size());
+    }
+
+    /**
+     * @brief Get line 2.
+     * @return View of line 2.
+     */
+    constexpr std::string_view getLine2() const
+    {
+        return std::string_view(line2.data(), line2.size());
+    }
+
+    /**
+     * @brief Check if nothing could be parsed from the callout.
+     * @return true if both lines are blank, false otherwise.
+     */
+    bool isBlank() const;
+
+    /**
+     * @brief Render a callout of the resolution of a PEL.
+     *
+     * Sample callout of a procedure and its rendering.
+     * 1. Priority: High, Procedure: BMCSP02
+     * L1 : H -BMCSP02
+     * L2 :
+     *
+     * Sample callout of a hardware and its rendering.
+     * 1. Location Code: U78DA.ND0.1234567-P0, Priority: Medium, PN: SVCDOCS
+     * L1 : M -SVCDOCS
+     * L2 : U78DA.ND0.1234567-P0
+     *
+     * @param[in] callOut - A line of the resolution.
+     * @return Rendered callout, blank if nothing could be parsed.
+     */
+    static CallOut parse(std::string_view callOut);
+
+    /**
+     * @brief Render the callouts of the resolution of a PEL.
+     * Each callout of the resolution is terminated by a new line.
+     *
+     * @param[in] resolution - Resolution of the PEL.
+     * @return Rendered callouts, at most maxCallOuts.
+     */
+    static std::vector<CallOut> parseResolution(std::string_view resolution);
+};
+} // namespace panel
@@ -2,13 +2,45 @@
 
 #include "types.hpp"
 
+#include <chrono>
 #include <cstdint>
 
+#ifndef BUTTON_DEBOUNCE_MS
+#define BUTTON_DEBOUNCE_MS 50
+#endif
+
+#ifndef DISPLAY_FRAME_INTERVAL_MS
+#define DISPLAY_FRAME_INTERVAL_MS 50
+#endif
+
+#ifndef PROGRESS_CODE_DWELL_MS
+#define PROGRESS_CODE_DWELL_MS 100
+#endif
+
 namespace panel
 {
 namespace constants
 {
 
+// Increment/decrement presses within this interval are applied together.
+static constexpr auto buttonDebounceInterval =
+    std::chrono::milliseconds(BUTTON_DEBOUNCE_MS);
+
+// Minimum interval between two frames written to the panel display.
+static constexpr auto displayFrameInterval =
+    std::chrono::milliseconds(DISPLAY_FRAME_INTERVAL_MS);
+
+// Minimum time a progress code stays displayed.
+static constexpr auto progressCodeDwell =
+    std::chrono::milliseconds(PROGRESS_CODE_DWELL_MS);
+
+/* Panel state snapshot kept across restarts of the app */
+static constexpr auto snapshotFilePath = "/var/lib/ibm-panel/snapshot";
+static constexpr auto snapshotSaveDelay = std::chrono::seconds(2);
+
+/* Progress codes of the boots, kept across restarts of the app */
+static constexpr auto timelineFilePath = "/var/lib/ibm-panel/timeline";
+
 static constexpr auto baseDevPath = "/dev/i2c-3";
 static constexpr auto bonnellBaseDevPath = "/dev/i2c-2";
 static constexpr auto rainLcdDevPath = "/dev/i2c-7";
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "transport.hpp"
+
+#include <array>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace panel
+{
+namespace display
+{
+/** @brief Sources of the content displayed on the panel. */
+enum class Layer : uint8_t
+{
+    PAGE,     // Function number and sub function the panel is at.
+    OVERLAY,  // Status or result of a function execution.
+    PROGRESS, // Progress code or SRC received from the host/BMC.
+    COUNT
+};
+
+/** @brief Two lines displayed on the panel. */
+struct Frame
+{
+    std::string line1;
+    std::string line2;
+
+    bool operator==(const Frame&) const = default;
+};
+
+/** @class Renderer
+ * @brief Display model of the panel and the renderer flushing it.
+ *
+ * Content is set per layer, the most recently updated layer is displayed.
+ * While lamp test is active the panel shows the lamp test and the model is
+ * displayed again once it ends.
+ *
+ * Frames are written at most once per frame interval, updates received in
+ * between are merged in the model and only the latest content is written. A
+ * frame identical to the one on the panel is not written again.
+ */
+class Renderer
+{
+  public:
+    /* Deleted Api's*/
+    Renderer(const Renderer&) = delete;
+    Renderer& operator=(const Renderer&) = delete;
+    Renderer(Renderer&&) = delete;
+    ~Renderer() = default;
+
+    /**
+     * @brief Constructor.
+     * @param[in] io - Boost asio io_context object pointer.
+     * @param[in] transport - Transport object to write to the panel.
+     */
+    Renderer(std::shared_ptr<boost::asio::io_context>& io,
+             std::shared_ptr<Transport> transport) :
+        transport(transport),
+        frameTimer(*io)
+    {
+    }
+
+    /**
+     * @brief Api to set the content of a layer and display it.
+     * @param[in] layer - Layer to update.
+     * @param[in] line1 - Line 1 content.
+     * @param[in] line2 - Line 2 content.
+     */
+    void show(const Layer layer, std::string_view line1,
+              std::string_view line2);
+
+    /**
+     * @brief Api to run the panel lamp test once.
+     * Panel ends the lamp test by itself, the model is written in full on the
+     * next update.
+     */
+    void lampTest();
+
+    /**
+     * @brief Api to start or end lamp test.
+     * Display updates are held back till the lamp test is ended.
+     *
+     * @param[in] state - true to start lamp test, false to end it.
+     */
+    void setLampTest(const bool state);
+
+    /**
+     * @brief Get the frame the model currently resolves to.
+     * @return Frame of the most recently updated layer.
+     */
+    const Frame& getFrame() const
+    {
+        return layers.at(static_cast<size_t>(activeLayer));
+    }
+
+  private:
+    /**
+     * @brief Api to flush the model now or schedule it for the end of the
+     * current frame interval.
+     */
+    void requestFlush();
+
+    /**
+     * @brief Api to write the model to the panel if it differs from what the
+     * panel displays.
+     */
+    void flush();
+
+    /* Transport object to write to the panel */
+    std::shared_ptr<Transport> transport;
+
+    /* Timer delaying a flush to the end of the frame interval */
+    boost::asio::steady_timer frameTimer;
+
+    /* Content of each layer */
+    std::array<Frame, static_cast<size_t>(Layer::COUNT)> layers;
+
+    /* Most recently updated layer */
+    Layer activeLayer = Layer::PAGE;
+
+    /* Lamp test state */
+    bool isLampTestActive = false;
+
+    /* Frame last written to the panel */
+    Frame panelFrame;
+
+    /* If the panel content is unknown, e.g. after lamp test */
+    bool isPanelFrameValid = false;
+
+    /* If a flush is scheduled on the frame timer */
+    bool isFlushPending = false;
+
+    /* Time of the last write */
+    std::chrono::steady_clock::time_point lastFlushTime{};
+};
+} // namespace display
+} // namespace panel
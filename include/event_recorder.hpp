@@ -0,0 +1,234 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace panel
+{
+namespace record
+{
+/**
+ * @brief Events recorded by the panel app.
+ * Values are stored in the recording, new events are added at the end.
+ */
+enum class EventType : uint8_t
+{
+    BUTTON = 1,            // Batch of input events from the button device.
+    PANEL_PRESENCE,        // LCD panel present property changed.
+    PEL_ADDED,             // PEL logged, with the properties read for it.
+    PEL_REMOVED,           // PEL deleted.
+    PROGRESS_CODE,         // Boot progress code from raw0.
+    BMC_STATE,             // BMC state.
+    POWER_STATE,           // Chassis power state.
+    BOOT_PROGRESS,         // Host boot progress state.
+    OPERATING_MODE,        // System operating mode from BIOS attributes.
+    DISPLAY,               // com.ibm.panel Display method.
+    LAMP_TEST,             // com.ibm.panel TriggerPanelLampTest method.
+    TOGGLE_FUNCTION_STATE, // com.ibm.panel toggleFunctionState method.
+    PROCESS_BUTTON,        // com.ibm.panel ProcessButton method.
+    EXECUTE_FUNCTION,      // com.ibm.panel ExecuteFunction method.
+    GET_ENABLED_FUNCTIONS, // com.ibm.panel getEnabledFunctions method.
+    OS_IPL_MODE            // com.ibm.panel OSIPLMode property set.
+};
+
+/**
+ * @brief Get name of an event type.
+ * @param[in] type - Event type.
+ * @return Name of the event type.
+ */
+const char* toString(const EventType type);
+
+/**
+ * @brief Payload of a recorded event.
+ *
+ * Values are appended in host byte order, strings and byte arrays are
+ * prefixed with their 16 bit length. Recordings are only meant to be replayed
+ * on a machine of the same endianness.
+ */
+class Payload
+{
+  public:
+    Payload() = default;
+
+    /**
+     * @brief Constructor.
+     * @param[in] bytes - Encoded payload to read from.
+     */
+    explicit Payload(types::Binary bytes) : bytes(std::move(bytes))
+    {
+    }
+
+    /**
+     * @brief Append a value.
+     * @param[in] value - Arithmetic value.
+     * @return Reference to the payload.
+     */
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    Payload& operator<<(const T value)
+    {
+        const auto pos = bytes.size();
+        bytes.resize(pos + sizeof(T));
+        std::memcpy(bytes.data() + pos, &value, sizeof(T));
+        return *this;
+    }
+
+    Payload& operator<<(const std::string& value);
+    Payload& operator<<(const types::Binary& value);
+
+    /**
+     * @brief Read the next value.
+     * @param[out] value - Arithmetic value read.
+     * @return Reference to the payload.
+     * @throw std::runtime_error if the payload is too short.
+     */
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    Payload& operator>>(T& value)
+    {
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return *this;
+    }
+
+    Payload& operator>>(std::string& value);
+    Payload& operator>>(types::Binary& value);
+
+    /**
+     * @brief Get the encoded payload.
+     * @return Payload bytes.
+     */
+    const types::Binary& data() const
+    {
+        return bytes;
+    }
+
+  private:
+    /**
+     * @brief Api to consume bytes from the read position.
+     * @param[in] size - Number of bytes.
+     * @return Pointer to the first byte consumed.
+     * @throw std::runtime_error if the payload is too short.
+     */
+    const types::Byte* take(const size_t size);
+
+    /* Encoded payload */
+    types::Binary bytes;
+
+    /* Read position */
+    size_t readPos = 0;
+};
+
+/** @brief An event read back from a recording. */
+struct Event
+{
+    // Time since the recording started.
+    std::chrono::nanoseconds timestamp;
+
+    // Event type.
+    EventType type;
+
+    // Event data.
+    Payload payload;
+};
+
+/**
+ * @class Recorder
+ * @brief Writes timestamped binary records of the events the panel handles.
+ *
+ * The recorder is inactive unless started, recording an event is then a
+ * single check. Each record is flushed as written, so that a recording
+ * survives the app crashing.
+ */
+class Recorder
+{
+  public:
+    Recorder() = default;
+    Recorder(const Recorder&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+    Recorder(Recorder&&) = delete;
+    ~Recorder() = default;
+
+    /**
+     * @brief Api to start recording.
+     * @param[in] path - File to record to, truncated if it exists.
+     * @throw std::runtime_error if the file can't be opened.
+     */
+    void start(const std::string& path);
+
+    /**
+     * @brief Check if recording.
+     * @return true if started, false otherwise.
+     */
+    bool isActive() const
+    {
+        return file.is_open();
+    }
+
+    /**
+     * @brief Api to record an event.
+     * @param[in] type - Event type.
+     * @param[in] values - Event data.
+     */
+    template <typename... Values>
+    void record(const EventType type, const Values&... values)
+    {
+        if (!isActive())
+        {
+            return;
+        }
+
+        Payload payload;
+        ((payload << values), ...);
+        write(type, payload);
+    }
+
+    /**
+     * @brief Api to record an event with its data already encoded.
+     * @param[in] type - Event type.
+     * @param[in] payload - Event data.
+     */
+    void record(const EventType type, const Payload& payload)
+    {
+        if (isActive())
+        {
+            write(type, payload);
+        }
+    }
+
+  private:
+    /**
+     * @brief Api to write a record to the file.
+     * @param[in] type - Event type.
+     * @param[in] payload - Event data.
+     */
+    void write(const EventType type, const Payload& payload);
+
+    /* Recording file */
+    std::ofstream file;
+
+    /* Time the recording started */
+    std::chrono::steady_clock::time_point startTime;
+};
+
+/**
+ * @brief Get the recorder of the app.
+ * @return Reference to the recorder.
+ */
+Recorder& recorder();
+
+/**
+ * @brief Read a recording.
+ * @param[in] path - Recording file.
+ * @return Events in the order recorded.
+ * @throw std::runtime_error if the file can't be read or isn't a recording.
+ */
+std::vector<Event> load(const std::string& path);
+
+} // namespace record
+} // namespace panel
@@ -1,20 +1,40 @@
 #pragma once
 
+#include "callout.hpp"
+#include "display.hpp"
+#include "function_bitmap.hpp"
+#include "function_telemetry.hpp"
+#include "pldm_fw.hpp"
+#include "snapshot.hpp"
+#include "src_record.hpp"
 #include "transport.hpp"
 #include "types.hpp"
 
+#include <boost/asio/spawn.hpp>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <sdbusplus/asio/connection.hpp>
 #include <sdbusplus/asio/object_server.hpp>
 #include <sdbusplus/message/native_types.hpp>
+#include <string_view>
 
 namespace panel
 {
+namespace functions
+{
+struct Registry;
+} // namespace functions
+
 /**
  * @brief A class to execute panel functionalities.
  */
 class Executor
 {
+    /* Registry binds the panel functions to the execute api(s). */
+    friend struct functions::Registry;
+
   public:
     /* Deleted Api's*/
     Executor(const Executor&) = delete;
@@ -24,18 +44,103 @@ class Executor
     /* Destructor */
     ~Executor() = default;
 
+    /**
+     * @brief Completion of a job.
+     * @param[in] success - true if the job succeeded, false otherwise.
+     */
+    using JobDone = std::function<void(bool success)>;
+
+    /**
+     * @brief Work of a long running function, started on the D-Bus and
+     * reporting its result through the completion.
+     * @param[in] done - To be called once the work completes.
+     */
+    using Job = std::function<void(JobDone done)>;
+
+    /**
+     * @brief Notified when the job of a function completes.
+     * @param[in] funcNumber - Function number.
+     * @param[in] subFuncNumber - Sub function(s) the job was started with.
+     * @param[in] success - true if the job succeeded, false otherwise.
+     */
+    using JobListener = std::function<void(
+        types::FunctionNumber funcNumber,
+        const types::FunctionalityList& subFuncNumber, bool success)>;
+
+    /**
+     * @brief Starts the job of a function.
+     * @param[in] funcNumber - Function number.
+     * @param[in] job - Work of the function.
+     * @param[in] done - To be called once the work completes.
+     */
+    using JobStarter = std::function<void(types::FunctionNumber funcNumber,
+                                          Job job, JobDone done)>;
+
     /**
      * @brief Constructor
      * @param[in] transport - Pointer to transport class.
+     * @param[in] conn - Pointer to the D-Bus connection of the app.
      * @param[in] iface - Pointer to Panel dbus interface.
      * @param[in] io - reference to io context class.
      */
     Executor(std::shared_ptr<Transport> transport,
+             std::shared_ptr<sdbusplus::asio::connection> conn,
              std::shared_ptr<sdbusplus::asio::dbus_interface>& iface,
              std::shared_ptr<boost::asio::io_context>& io) :
         transport(transport),
-        iface(iface), io_context(io)
+        conn(conn), iface(iface), io_context(io), pldm(io, conn),
+        renderer(io, transport)
+    {
+    }
+
+    /**
+     * @brief Get the execution latency and outcome of the functions.
+     * @return Function telemetry.
+     */
+    inline const FunctionTelemetry& getTelemetry() const
+    {
+        return telemetry;
+    }
+
+    /**
+     * @brief Api to set the listener notified on completion of jobs.
+     * @param[in] listener - Job completion listener.
+     */
+    inline void setJobListener(JobListener listener)
+    {
+        jobListener = std::move(listener);
+    }
+
+    /**
+     * @brief Api to set how the jobs are started.
+     * Jobs are run as soon as started by default. A starter can hold them
+     * instead, e.g. for a test to keep them off the D-Bus.
+     * @param[in] starter - Job starter.
+     */
+    inline void setJobStarter(JobStarter starter)
     {
+        jobStarter = std::move(starter);
+    }
+
+    /**
+     * @brief Api to check if the job of a function is running.
+     * @param[in] funcNumber - Function number.
+     * @return true if running, false otherwise.
+     */
+    inline bool isJobRunning(const types::FunctionNumber funcNumber) const
+    {
+        return runningJobs.test(funcNumber);
+    }
+
+    /**
+     * @brief Get the renderer of the panel display.
+     * All the content to be displayed on the panel goes through it.
+     *
+     * @return Display renderer.
+     */
+    display::Renderer& getRenderer()
+    {
+        return renderer;
     }
 
     /**
@@ -54,23 +159,45 @@ class Executor
 
     /**
      * @brief Api to store callout list of last PEL.
-     * @param[in] callOuts - list of callouts.
+     * @param[in] callOuts - Callouts, rendered for display.
      */
-    inline void pelCallOutList(const std::vector<std::string>& callOuts)
+    inline void pelCallOutList(std::vector<CallOut>&& callOuts)
     {
-        callOutList = callOuts;
+        callOutList = std::move(callOuts);
+        snapshot::store().markDirty();
     }
 
     /**
      * @brief An api to store latest SRC and Hexwords.
-     * This api will receive string consisting SRC and Hexwords and store them
-     * to be used in function 11, 12 and 13.
+     * This api will receive the SRC and Hexwords of the last PEL or progress
+     * code and store them to be used in function 11, 12 and 13.
      *
-     * @param[in] srcAndHexwords- String consisting of SRC and hex words.
+     * @param[in] srcRecord - SRC and hex words.
+     */
+    inline void storeSRCAndHexwords(const SrcRecord& srcRecord)
+    {
+        latestSrc = srcRecord;
+        snapshot::store().markDirty();
+    }
+
+    /**
+     * @brief An api to notify host state change.
+     * Panel effecter details cached from the host PDR are valid only for the
+     * current host boot and are dropped on host state change.
+     */
+    inline void hostStateChanged()
+    {
+        pldm.invalidateCache();
+    }
+
+    /**
+     * @brief An api to run without a host.
+     * Functions sent to PHYP complete at once with success, no PLDM message
+     * is sent.
      */
-    inline void storeSRCAndHexwords(const std::string& srcAndHexwords)
+    inline void emulateHost()
     {
-        latestSrcAndHexwords = srcAndHexwords;
+        pldm.emulateHost();
     }
 
     /**
@@ -82,21 +209,20 @@ class Executor
     uint8_t getPelEventIdCount();
 
     /**
-     * @brief An api to store last 25 IPL SRCs.
+     * @brief An api to store an IPL SRC in the progress code timeline.
+     * Function 63 lists the last 25 of them.
+     *
      * @param[in] progressCode - The progress code to store.
      */
-    void storeIPLSRC(const std::string& progressCode);
+    void storeIPLSRC(const SrcRecord& progressCode);
 
     /**
      * @brief An api to get count of IPL SRCs.
      * It will be required to enable/disable sub functions for function 63 based
      * on SRC count.
-     * @return The current count of stored progress code SRCs.
+     * @return The current count of stored progress code SRCs, at most 25.
      */
-    inline uint8_t getIPLSRCCount() const
-    {
-        return iplSrcs.size();
-    }
+    uint8_t getIPLSRCCount() const;
 
     /**
      * @brief An api to get state of service switch 1.
@@ -139,27 +265,33 @@ class Executor
     }
 
     /**
-     * @brief An api to store event id of last PEL.
-     * This is required to be dispalyed in function 11 to 13.
-     *
-     * @param pelEventId - Event id data of last PEL.
+     * @brief Api to copy the state kept across restarts to a snapshot.
+     * @param[out] state - Snapshot of the panel state.
      */
-    inline void storeLastPelEventId(const std::string& pelEventId)
-    {
-        latestSrcAndHexwords = pelEventId;
-    }
+    void saveState(snapshot::PanelState& state) const;
+
+    /**
+     * @brief Api to restore the state kept across restarts from a snapshot.
+     * @param[in] state - Snapshot of the panel state.
+     */
+    void restoreState(const snapshot::PanelState& state);
 
     /**
      * @brief API to execute functions on requests from external source
      * This method is called whenever there is an external request to trigger a
      * function.
      *
+     * Functions executed by PHYP complete only once PHYP responds to the
+     * request, the calling coroutine is suspended till then.
+     *
      * @param[in] funcNum - Function number.
+     * @param[in] yield - Context of the calling coroutine.
      *
      * @return status(success/failure, display line 1, display line2)
      */
     types::ReturnStatus
-        executeFunctionDirectly(const types::FunctionNumber funcNum);
+        executeFunctionDirectly(const types::FunctionNumber funcNum,
+                                boost::asio::yield_context yield);
 
   private:
     /**
@@ -269,6 +401,45 @@ class Executor
     /** @brief API to execute function 30. */
     void execute30(const types::FunctionalityList& subFuncNumber);
 
+    /**
+     * @brief Api to run a long running function as a job.
+     *
+     * The in progress frame of the function is displayed and the job is
+     * started, the panel keeps serving the buttons while it runs. Once done,
+     * 00 or FF is displayed and the job listener is notified. Execution of a
+     * function whose job is still running is ignored.
+     *
+     * @param[in] funcNumber - function number
+     * @param[in] subFuncNumber - sub function number list
+     * @param[in] job - Work of the function.
+     */
+    void runJob(const types::FunctionNumber funcNumber,
+                const types::FunctionalityList& subFuncNumber, Job job);
+
+    /**
+     * @brief To get the function and sub function number shown on execution.
+     * @param[in] funcNumber - function number
+     * @param[in] subFuncNumber - sub function number list
+     * @return Function number followed by the sub function number.
+     */
+    std::string getFunctionPrefix(
+        const types::FunctionNumber funcNumber,
+        const types::FunctionalityList& subFuncNumber) const;
+
+    /**
+     * @brief To get the execution result line (function success/failure
+     * (00/FF)).
+     * @param[in] funcNumber - function number
+     * @param[in] subFuncNumber - sub function number list
+     * @param[in] result - Execution result - true:success(00) / false:failure
+     * (FF)
+     * @return Execution result line.
+     */
+    std::string
+        getExecutionStatus(const types::FunctionNumber funcNumber,
+                           const types::FunctionalityList& subFuncNumber,
+                           const bool result) const;
+
     /**
      * @brief To display the execution result (function success/failure
      * (00/FF)).
@@ -303,7 +474,8 @@ class Executor
      * @brief API to send function number to PHYP.
      * Some of the functions(like 21,22,34,41,65-70) needs to be executed by
      * PHYP. This method sends the function number to phyp via the PldmFramework
-     * api and displays 00 on a successful send and FF on a failure.
+     * api and displays 00 once PHYP acknowledges the request and FF on a
+     * failure or timeout.
      *
      * @param[in] funcNumber - Function number.
      */
@@ -312,14 +484,29 @@ class Executor
     /*Transport class object*/
     std::shared_ptr<Transport> transport;
 
-    /* List of resolution property added to callouts */
-    std::vector<std::string> callOutList;
+    /* D-Bus connection the jobs are run on */
+    std::shared_ptr<sdbusplus::asio::connection> conn;
+
+    /* Functions whose job is running */
+    functions::FunctionBitmap runningJobs;
+
+    /* Notified on completion of jobs */
+    JobListener jobListener;
+
+    /* Starts the jobs, if set in place of running them at once */
+    JobStarter jobStarter;
 
-    /* List of last 25 IPL SRCs. */
-    std::deque<std::string> iplSrcs;
+    /* Execution latency and outcome of the functions */
+    FunctionTelemetry telemetry;
 
-    /* Queue of last 25 PEL SRCs */
-    std::deque<std::string> pelEventIdQueue;
+    /* Set by a function whose outcome is known only on completion */
+    bool isOutcomeDeferred = false;
+
+    /* Callouts of the last PEL, rendered for display */
+    std::vector<CallOut> callOutList;
+
+    /* List of last 25 PEL SRCs */
+    SrcHistory pelSrcs;
 
     /*State of function 25 excution. Needed for function 26*/
     bool serviceSwitch1State = false;
@@ -330,15 +517,17 @@ class Executor
     /* Event for timer required in function 74 */
     std::shared_ptr<boost::asio::io_context> io_context;
 
+    /* Pldm framework to send panel functions to PHYP */
+    PldmFramework pldm;
+
+    /* Display model and renderer of the panel */
+    display::Renderer renderer;
+
     /* OS IPL mode state */
     bool osIplMode = false;
 
-    /* SRC and HEX words */
-    std::string latestSrcAndHexwords;
-
-    /* To keep track if the execute request is from external or not */
-    bool isExternallyTriggered = false;
+    /* SRC and HEX words of the last PEL or progress code */
+    std::optional<SrcRecord> latestSrc;
 
-    types::ReturnStatus executionStatus = std::make_tuple(false, "", "");
 }; // class Executor
 } // namespace panel
\ No newline at end of file
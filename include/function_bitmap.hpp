@@ -0,0 +1,209 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <optional>
+
+namespace panel
+{
+namespace functions
+{
+/** @class FunctionBitmap
+ * @brief Set of function numbers, one bit per function number.
+ *
+ * Holds function numbers 0 to 127. Next and previous set members are found
+ * with count trailing/leading zero on the 64 bit words.
+ */
+class FunctionBitmap
+{
+  public:
+    /** @brief Number of function numbers the bitmap can hold. */
+    static constexpr size_t capacity = 128;
+
+    /**
+     * @brief Add a function.
+     * @param[in] funcNumber - Function number.
+     */
+    constexpr void set(const types::FunctionNumber funcNumber)
+    {
+        words[funcNumber / bitsPerWord] |= bit(funcNumber);
+    }
+
+    /**
+     * @brief Remove a function.
+     * @param[in] funcNumber - Function number.
+     */
+    constexpr void reset(const types::FunctionNumber funcNumber)
+    {
+        words[funcNumber / bitsPerWord] &= ~bit(funcNumber);
+    }
+
+    /**
+     * @brief Check if a function is present.
+     * @param[in] funcNumber - Function number.
+     * @return true if present, false otherwise.
+     */
+    constexpr bool test(const types::FunctionNumber funcNumber) const
+    {
+        return (funcNumber < capacity) &&
+               (words[funcNumber / bitsPerWord] & bit(funcNumber)) != 0;
+    }
+
+    /**
+     * @brief Get number of functions present.
+     * @return Count of functions.
+     */
+    constexpr size_t count() const
+    {
+        size_t total = 0;
+        for (const auto word : words)
+        {
+            total += std::popcount(word);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Check if the bitmap is empty.
+     * @return true if no function is present, false otherwise.
+     */
+    constexpr bool none() const
+    {
+        for (const auto word : words)
+        {
+            if (word != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Add all the functions of another bitmap.
+     * @param[in] other - Bitmap to merge.
+     * @return Reference to this bitmap.
+     */
+    constexpr FunctionBitmap& operator|=(const FunctionBitmap& other)
+    {
+        for (size_t index = 0; index < words.size(); ++index)
+        {
+            words[index] |= other.words[index];
+        }
+        return *this;
+    }
+
+    constexpr bool operator==(const FunctionBitmap&) const = default;
+
+    /**
+     * @brief Get the lowest function present.
+     * @return Function number, std::nullopt if the bitmap is empty.
+     */
+    constexpr std::optional<types::FunctionNumber> first() const
+    {
+        return findFrom(0);
+    }
+
+    /**
+     * @brief Get the highest function present.
+     * @return Function number, std::nullopt if the bitmap is empty.
+     */
+    constexpr std::optional<types::FunctionNumber> last() const
+    {
+        return findUpTo(capacity - 1);
+    }
+
+    /**
+     * @brief Get the first function present after a given function.
+     * @param[in] funcNumber - Function number to search after.
+     * @return Function number, std::nullopt if there is none.
+     */
+    constexpr std::optional<types::FunctionNumber>
+        next(const types::FunctionNumber funcNumber) const
+    {
+        return findFrom(static_cast<size_t>(funcNumber) + 1);
+    }
+
+    /**
+     * @brief Get the last function present before a given function.
+     * @param[in] funcNumber - Function number to search before.
+     * @return Function number, std::nullopt if there is none.
+     */
+    constexpr std::optional<types::FunctionNumber>
+        prev(const types::FunctionNumber funcNumber) const
+    {
+        if (funcNumber == 0)
+        {
+            return std::nullopt;
+        }
+        return findUpTo(static_cast<size_t>(funcNumber) - 1);
+    }
+
+  private:
+    static constexpr size_t bitsPerWord = 64;
+
+    static constexpr uint64_t bit(const size_t position)
+    {
+        return uint64_t{1} << (position % bitsPerWord);
+    }
+
+    /**
+     * @brief Find the lowest function present at or after a position.
+     * @param[in] position - Position to start from.
+     * @return Function number, std::nullopt if there is none.
+     */
+    constexpr std::optional<types::FunctionNumber>
+        findFrom(const size_t position) const
+    {
+        if (position >= capacity)
+        {
+            return std::nullopt;
+        }
+
+        size_t index = position / bitsPerWord;
+        uint64_t word = words[index] & (~uint64_t{0}
+                                        << (position % bitsPerWord));
+        while (word == 0)
+        {
+            if (++index == words.size())
+            {
+                return std::nullopt;
+            }
+            word = words[index];
+        }
+        return static_cast<types::FunctionNumber>(index * bitsPerWord +
+                                                  std::countr_zero(word));
+    }
+
+    /**
+     * @brief Find the highest function present at or before a position.
+     * @param[in] position - Position to start from.
+     * @return Function number, std::nullopt if there is none.
+     */
+    constexpr std::optional<types::FunctionNumber>
+        findUpTo(const size_t position) const
+    {
+        size_t index = position / bitsPerWord;
+        uint64_t word = words[index] &
+                        (~uint64_t{0} >>
+                         (bitsPerWord - 1 - (position % bitsPerWord)));
+        while (word == 0)
+        {
+            if (index-- == 0)
+            {
+                return std::nullopt;
+            }
+            word = words[index];
+        }
+        return static_cast<types::FunctionNumber>(
+            index * bitsPerWord + (bitsPerWord - 1) - std::countl_zero(word));
+    }
+
+    /* Bit n of the bitmap is bit (n % 64) of word (n / 64). */
+    std::array<uint64_t, capacity / bitsPerWord> words{};
+};
+} // namespace functions
+} // namespace panel
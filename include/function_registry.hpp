@@ -0,0 +1,321 @@
+#pragma once
+
+#include "executor.hpp"
+#include "function_bitmap.hpp"
+#include "types.hpp"
+
+#include <array>
+#include <bit>
+#include <string_view>
+
+namespace panel
+{
+namespace functions
+{
+/**
+ * @brief Bits of the system state a panel function can depend on.
+ * A function is enabled when all the bits of its enable mask are set in the
+ * system state.
+ */
+enum SystemStateMask : uint8_t
+{
+    NO_MASK = 0x00,
+    ENABLE_BY_PHYP = 0x01,
+    DISABLE_BY_PHYP = static_cast<SystemStateMask>(~ENABLE_BY_PHYP),
+    ENABLE_BMC_STANDBY_STATE = 0x20,
+    DISABLE_BMC_STANDBY_STATE =
+        static_cast<SystemStateMask>(~ENABLE_BMC_STANDBY_STATE),
+    ENABLE_POWER_STATE = 0x04,
+    DISABLE_POWER_STATE = static_cast<SystemStateMask>(~ENABLE_POWER_STATE),
+    ENABLE_PHYP_RUNTIME_STATE = 0x08,
+    DISABLE_PHYP_RUNTIME_STATE =
+        static_cast<SystemStateMask>(~ENABLE_PHYP_RUNTIME_STATE),
+    ENABLE_CE_MODE = 0x10,
+    DISABLE_CE_MODE = static_cast<SystemStateMask>(~ENABLE_CE_MODE),
+    ENABLE_MANUAL_MODE = 0x02,
+    DISABLE_MANUAL_MODE = static_cast<SystemStateMask>(~ENABLE_MANUAL_MODE),
+};
+
+/* Masks shared by groups of functions */
+static constexpr types::FunctionMask poweredManualMask =
+    SystemStateMask::ENABLE_POWER_STATE | SystemStateMask::ENABLE_MANUAL_MODE;
+static constexpr types::FunctionMask serviceMask =
+    SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_CE_MODE;
+static constexpr types::FunctionMask phypMask =
+    SystemStateMask::ENABLE_PHYP_RUNTIME_STATE |
+    SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_BY_PHYP;
+static constexpr types::FunctionMask phypServiceMask =
+    phypMask | SystemStateMask::ENABLE_CE_MODE;
+
+/** @brief Highest function number the registry can hold. */
+static constexpr types::FunctionNumber maxFunctionNumber = 127;
+
+/**
+ * @brief Executes a function.
+ * @param[in] executor - Executor of the panel.
+ * @param[in] funcNumber - Function number.
+ * @param[in] subFuncNumber - Sub function(s) selected.
+ */
+using Handler = void (*)(Executor& executor,
+                         const types::FunctionNumber funcNumber,
+                         const types::FunctionalityList& subFuncNumber);
+
+/** @brief Attributes of a panel function. */
+struct Function
+{
+    // Function number.
+    types::FunctionNumber number;
+
+    // Function not dependent on the state of the machine or any other element
+    // is enabled by default.
+    bool defaultEnabled;
+
+    // Debounce SRC to display before executing, empty if not required.
+    std::string_view debounceSrc;
+
+    // Last sub function, 0 if the function has no sub functions.
+    types::FunctionNumber subRangeEnd;
+
+    // Conditions to enable the function.
+    /* 0th bit - Enabled by Phyp.
+     * 1st bit - Operation mode Normal/Manual 0/1
+     * 2nd bit - Power on state Off/On 0/1
+     * 3rd bit - Is Runtime No/Yes 0/1
+     * 4th bit - CE No/Yes 0/1
+     * 5th bit - At standby No/Yes 0/1 - BMC state not ready to ready.
+     */
+    types::FunctionMask enableMask;
+
+    // Function can be executed over D-Bus.
+    bool remoteCapable;
+
+    // Handler executing the function.
+    Handler handler;
+};
+
+/** @class Registry
+ * @brief Compile time registry of the panel functions.
+ *
+ * Functions are listed in the order they are traversed on the panel. The
+ * registry is a friend of the Executor so that the handlers can be bound to
+ * its private execute methods.
+ */
+struct Registry
+{
+  private:
+    template <void (Executor::*method)()>
+    static void invoke(Executor& executor, const types::FunctionNumber,
+                       const types::FunctionalityList&)
+    {
+        (executor.*method)();
+    }
+
+    template <void (Executor::*method)(const types::FunctionalityList&)>
+    static void invokeWithSubFunctions(
+        Executor& executor, const types::FunctionNumber,
+        const types::FunctionalityList& subFuncNumber)
+    {
+        (executor.*method)(subFuncNumber);
+    }
+
+    template <void (Executor::*method)(const types::FunctionNumber)>
+    static void invokeWithSubFunction(
+        Executor& executor, const types::FunctionNumber,
+        const types::FunctionalityList& subFuncNumber)
+    {
+        (executor.*method)(subFuncNumber.at(0));
+    }
+
+    template <void (Executor::*method)(const types::FunctionNumber)>
+    static void invokeWithFunctionNumber(Executor& executor,
+                                         const types::FunctionNumber funcNumber,
+                                         const types::FunctionalityList&)
+    {
+        (executor.*method)(funcNumber);
+    }
+
+    static void sendToPhyp(Executor& executor,
+                           const types::FunctionNumber funcNumber,
+                           const types::FunctionalityList&)
+    {
+        executor.sendFuncNumToPhyp(funcNumber);
+    }
+
+  public:
+    /** @brief List of functions provided by the panel. */
+    static constexpr auto table = std::to_array<Function>({
+        {1, true, "", 0, NO_MASK, false, invoke<&Executor::execute01>},
+        {2, true, "", 0, NO_MASK, false,
+         invokeWithSubFunctions<&Executor::execute02>},
+        {3, false, "A1008003", 0, poweredManualMask, false,
+         invoke<&Executor::execute03>},
+        {4, true, "", 0, NO_MASK, false, invoke<&Executor::execute04>},
+        {8, false, "A1008008", 0, poweredManualMask, false,
+         invoke<&Executor::execute08>},
+        {11, false, "", 0, NO_MASK, false, invoke<&Executor::execute11>},
+        {12, false, "", 0, NO_MASK, false, invoke<&Executor::execute12>},
+        {13, false, "", 0, NO_MASK, false, invoke<&Executor::execute13>},
+        {14, false, "", 0, NO_MASK, false,
+         invokeWithFunctionNumber<&Executor::execute14to19>},
+        {15, false, "", 0, NO_MASK, false,
+         invokeWithFunctionNumber<&Executor::execute14to19>},
+        {16, false, "", 0, NO_MASK, false,
+         invokeWithFunctionNumber<&Executor::execute14to19>},
+        {17, false, "", 0, NO_MASK, false,
+         invokeWithFunctionNumber<&Executor::execute14to19>},
+        {18, false, "", 0, NO_MASK, false,
+         invokeWithFunctionNumber<&Executor::execute14to19>},
+        {19, false, "", 0, NO_MASK, false,
+         invokeWithFunctionNumber<&Executor::execute14to19>},
+        {20, true, "", 0, NO_MASK, false, invoke<&Executor::execute20>},
+        {21, false, "", 0, phypMask, true, sendToPhyp},
+        {22, false, "A1003022", 0, phypMask, true, sendToPhyp},
+        {25, true, "", 0, ENABLE_MANUAL_MODE, false,
+         invoke<&Executor::execute25>},
+        {26, true, "", 0, ENABLE_MANUAL_MODE, false,
+         invoke<&Executor::execute26>},
+        {30, false, "", 0x01,
+         ENABLE_BMC_STANDBY_STATE | ENABLE_MANUAL_MODE, false,
+         invokeWithSubFunctions<&Executor::execute30>},
+        {34, false, "", 0, phypMask, true, sendToPhyp},
+        {41, false, "A1003041", 0, phypMask, false, sendToPhyp},
+        {42, false, "A1003042", 0,
+         ENABLE_PHYP_RUNTIME_STATE | ENABLE_MANUAL_MODE, false,
+         invoke<&Executor::execute42>},
+        {43, true, "A1003043", 0, ENABLE_MANUAL_MODE, false,
+         invoke<&Executor::execute43>},
+        {55, true, "", 0x0D, serviceMask, false,
+         invokeWithSubFunctions<&Executor::execute55>},
+        {63, true, "", 0x18, serviceMask, false,
+         invokeWithSubFunction<&Executor::execute63>},
+        {64, true, "", 0x18, serviceMask, false,
+         invokeWithSubFunction<&Executor::execute64>},
+        {65, false, "", 0, phypServiceMask, true, sendToPhyp},
+        {66, false, "", 0, phypServiceMask, true, sendToPhyp},
+        {67, false, "", 0, phypServiceMask, true, sendToPhyp},
+        {68, false, "", 0, phypServiceMask, true, sendToPhyp},
+        {69, false, "", 0, phypServiceMask, true, sendToPhyp},
+        {70, false, "", 0, phypServiceMask, true, sendToPhyp},
+        {73, false, "A170800B", 0, serviceMask, false,
+         invoke<&Executor::execute73>},
+        {74, false, "", 0, serviceMask, false, invoke<&Executor::execute74>},
+    });
+
+    /** @brief Index value of a function number not in the registry. */
+    static constexpr uint8_t invalidIndex = 0xFF;
+
+    /** @brief Position in table of each function number. */
+    static constexpr std::array<uint8_t, maxFunctionNumber + 1> index = [] {
+        std::array<uint8_t, maxFunctionNumber + 1> positions{};
+        positions.fill(invalidIndex);
+        for (size_t pos = 0; pos < table.size(); ++pos)
+        {
+            positions[table[pos].number] = static_cast<uint8_t>(pos);
+        }
+        return positions;
+    }();
+
+    /**
+     * @brief Get position of a function in the table.
+     * @param[in] funcNumber - Function number.
+     * @return Position of the function, invalidIndex if not registered.
+     */
+    static constexpr uint8_t indexOf(const types::FunctionNumber funcNumber)
+    {
+        return (funcNumber > maxFunctionNumber) ? invalidIndex
+                                                : index[funcNumber];
+    }
+
+    /**
+     * @brief Get attributes of a function.
+     * @param[in] funcNumber - Function number.
+     * @return Pointer to the function attributes, nullptr if not registered.
+     */
+    static constexpr const Function*
+        find(const types::FunctionNumber funcNumber)
+    {
+        const auto pos = indexOf(funcNumber);
+        return (pos == invalidIndex) ? nullptr : &table[pos];
+    }
+
+    /** @brief Functions depending on each bit of the system state. */
+    static constexpr std::array<FunctionBitmap, 8> dependents = [] {
+        std::array<FunctionBitmap, 8> bitmaps{};
+        for (const auto& function : table)
+        {
+            for (size_t bit = 0; bit < bitmaps.size(); ++bit)
+            {
+                if (function.enableMask & (1 << bit))
+                {
+                    bitmaps[bit].set(function.number);
+                }
+            }
+        }
+        return bitmaps;
+    }();
+
+    /**
+     * @brief Get the functions depending on some bits of the system state.
+     * @param[in] stateBits - Bits of the system state.
+     * @return Functions whose enable mask has any of the bits.
+     */
+    static constexpr FunctionBitmap
+        dependentsOf(const types::FunctionMask stateBits)
+    {
+        FunctionBitmap functions;
+        for (unsigned bits = stateBits; bits != 0; bits &= (bits - 1))
+        {
+            functions |= dependents[std::countr_zero(bits)];
+        }
+        return functions;
+    }
+
+    /**
+     * @brief Validate the registry.
+     * @return true if the table is well formed, false otherwise.
+     */
+    static constexpr bool isValid()
+    {
+        for (size_t pos = 0; pos < table.size(); ++pos)
+        {
+            const auto& function = table[pos];
+
+            // Panel traverses the functions in table order.
+            if (pos != 0 && table[pos - 1].number >= function.number)
+            {
+                return false;
+            }
+
+            if (function.number > maxFunctionNumber ||
+                function.handler == nullptr)
+            {
+                return false;
+            }
+
+            // SRC is 8 characters.
+            if (!function.debounceSrc.empty() &&
+                function.debounceSrc.size() != 8)
+            {
+                return false;
+            }
+
+            // Remote execution is only for functions PHYP enables at runtime.
+            if (function.remoteCapable &&
+                ((function.enableMask & phypMask) != phypMask))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+static_assert(Registry::table.front().number == 1,
+              "Panel comes up at function 01, it has to be first.");
+static_assert(Registry::table.size() < Registry::invalidIndex,
+              "Registry does not fit the index type.");
+static_assert(Registry::isValid(),
+              "Panel function registry is not well formed.");
+
+} // namespace functions
+} // namespace panel
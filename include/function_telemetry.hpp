@@ -0,0 +1,65 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <string>
+
+namespace panel
+{
+/** @class FunctionTelemetry
+ * @brief Execution latency and outcome of the panel functions.
+ *
+ * Keeps per function number the success and failure counts, the last error
+ * and the latency of the latest executions, from which the percentiles are
+ * computed on request.
+ */
+class FunctionTelemetry
+{
+  public:
+    /** @brief Number of latest executions the percentiles are computed on. */
+    static constexpr size_t sampleCount = 256;
+
+    /**
+     * @brief Api to record an execution of a function.
+     * @param[in] funcNumber - Function number.
+     * @param[in] latency - Time taken by the execution.
+     * @param[in] error - Reason of the failure, empty on success.
+     */
+    void record(const types::FunctionNumber funcNumber,
+                const std::chrono::steady_clock::duration latency,
+                const std::string& error = {});
+
+    /**
+     * @brief Get the statistics of all the executed functions.
+     * @return map{function number, (success count, failure count, p50, p99
+     * and max latency in us, last error)}.
+     */
+    types::FunctionStatistics getStatistics() const;
+
+  private:
+    /** @brief Statistics of a function. */
+    struct Entry
+    {
+        // Number of successful executions.
+        uint64_t successCount = 0;
+
+        // Number of failed executions.
+        uint64_t failureCount = 0;
+
+        // Latency of the latest executions in us, oldest overwritten first.
+        std::array<uint32_t, sampleCount> samples{};
+
+        // Longest execution.
+        std::chrono::microseconds maxTime{0};
+
+        // Reason of the last failure.
+        std::string lastError;
+    };
+
+    /* Statistics per function number */
+    std::map<types::FunctionNumber, Entry> entries;
+};
+} // namespace panel
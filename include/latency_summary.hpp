@@ -0,0 +1,75 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <type_traits>
+
+namespace panel
+{
+/** @brief Distribution of latency samples, in us. */
+struct LatencySummary
+{
+    uint64_t count = 0;
+    uint64_t mean = 0;
+    uint64_t min = 0;
+    uint64_t p50 = 0;
+    uint64_t p90 = 0;
+    uint64_t p99 = 0;
+    uint64_t max = 0;
+};
+
+/**
+ * @brief Summarize latency samples.
+ * Percentiles are nearest rank: the smallest sample with at least pct
+ * percent of the samples at or below it.
+ *
+ * @param[in,out] samples - Durations, or integers in us. Sorted in place.
+ * @return Summary, all zero if there is no sample.
+ */
+template <typename Sample>
+LatencySummary summarizeLatency(std::span<Sample> samples)
+{
+    LatencySummary summary;
+    if (samples.empty())
+    {
+        return summary;
+    }
+
+    const auto toMicroseconds = [](const Sample& sample) -> uint64_t {
+        if constexpr (std::is_integral_v<Sample>)
+        {
+            return sample;
+        }
+        else
+        {
+            return std::chrono::duration_cast<std::chrono::microseconds>(
+                       sample)
+                .count();
+        }
+    };
+    const auto percentile = [&samples, &toMicroseconds](const size_t pct) {
+        // Rank is ceil(pct * n / 100), counted from 1.
+        const auto rank = (pct * samples.size() + 99) / 100;
+        return toMicroseconds(samples[std::max<size_t>(rank, 1) - 1]);
+    };
+
+    std::sort(samples.begin(), samples.end());
+    summary.count = samples.size();
+    summary.mean = std::accumulate(samples.begin(), samples.end(),
+                                   uint64_t{0},
+                                   [&toMicroseconds](const uint64_t total,
+                                                     const Sample& sample) {
+                                       return total + toMicroseconds(sample);
+                                   }) /
+                   samples.size();
+    summary.min = percentile(0);
+    summary.p50 = percentile(50);
+    summary.p90 = percentile(90);
+    summary.p99 = percentile(99);
+    summary.max = percentile(100);
+    return summary;
+}
+} // namespace panel
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "executor.hpp"
+#include "function_bitmap.hpp"
+#include "snapshot.hpp"
 #include "transport.hpp"
 #include "types.hpp"
 
 #include <memory>
+#include <string_view>
 #include <tuple>
 
 namespace panel
@@ -28,7 +31,14 @@ class PanelStateManager
     PanelStateManager& operator=(const PanelStateManager&) = delete;
     PanelStateManager(PanelStateManager&&) = delete;
 
-    ~PanelStateManager() = default;
+    /**
+     * @brief Destructor.
+     * Stops listening to the jobs of the executor.
+     */
+    ~PanelStateManager()
+    {
+        funcExecutor->setJobListener(nullptr);
+    }
 
     /**
      * @brief Api to reset state of Op-Panel to default.
@@ -84,6 +94,16 @@ class PanelStateManager
      */
     void processPanelButtonEvent(const types::ButtonEvent& button);
 
+    /**
+     * @brief Api to move the panel by a number of increment/decrement steps.
+     * The steps are applied as a single transition, only the state reached
+     * at the end is displayed.
+     *
+     * @param[in] offset - Number of steps, positive to increment and negative
+     * to decrement.
+     */
+    void processPanelNavigation(const int offset);
+
     /**
      * @brief Api to set state of Panel state handler altogether.
      * @param[in] isEnabled - boolean value to enable/disable panel state
@@ -105,6 +125,12 @@ class PanelStateManager
         funcExecutor(execute)
     {
         initPanelState();
+        funcExecutor->setJobListener(
+            [this](const types::FunctionNumber funcNumber,
+                   const types::FunctionalityList& subFuncNumber,
+                   const bool success) {
+                jobCompleted(funcNumber, subFuncNumber, success);
+            });
     }
 
     /**
@@ -139,10 +165,12 @@ class PanelStateManager
     /**
      * @brief API to trigger functions on request from external source
      * @param[in] funcNum - Function number
+     * @param[in] yield - Context of the calling coroutine.
      * @return status of the function
      */
     types::ReturnStatus
-        triggerFunctionDirectly(const types::FunctionNumber funcNum);
+        triggerFunctionDirectly(const types::FunctionNumber funcNum,
+                                boost::asio::yield_context yield);
 
     /**
      * @brief API to get list of enabled functions
@@ -151,6 +179,28 @@ class PanelStateManager
      */
     types::Binary getEnabledFunctionsList();
 
+    /**
+     * @brief Api to copy the state kept across restarts to a snapshot.
+     * @param[out] state - Snapshot of the panel state.
+     */
+    void saveState(snapshot::PanelState& state) const;
+
+    /**
+     * @brief Api to restore the system state bits kept across restarts.
+     * Only CE and manual mode are restored, the rest of the system state is
+     * read back from D-Bus.
+     *
+     * @param[in] state - Snapshot of the panel state.
+     */
+    void restoreState(const snapshot::PanelState& state);
+
+    /**
+     * @brief Api to move the panel to a function and display it.
+     * @param[in] funcNumber - Function number.
+     * @return true if the panel moved, false if the function is not enabled.
+     */
+    bool moveToFunction(const types::FunctionNumber funcNumber);
+
   private:
     /**
      * @brief An Api to set the initial state of PanelState class.
@@ -181,6 +231,19 @@ class PanelStateManager
      */
     void setIPLParameters(const types::ButtonEvent& button);
 
+    /**
+     * @brief An api to apply the result of a function run as a job.
+     * Operating mode selected in function 02 takes effect once its settings
+     * are written.
+     *
+     * @param[in] funcNumber - Function number.
+     * @param[in] subFuncNumber - Sub function(s) the job was started with.
+     * @param[in] success - true if the job succeeded, false otherwise.
+     */
+    void jobCompleted(const types::FunctionNumber funcNumber,
+                      const types::FunctionalityList& subFuncNumber,
+                      const bool success);
+
     /** @brief API to create the display string. */
     void createDisplayString() const;
 
@@ -210,9 +273,23 @@ class PanelStateManager
     /**
      * @brief An api to toggle state of panel functons.
      * This api will be called everytime any bit changes in system state to
-     * check if any panel function can be enabled/disabled based on that.
+     * check if any panel function can be enabled/disabled based on that. Only
+     * the functions depending on the changed bits are evaluated.
+     *
+     * @param[in] stateBits - Bits of the system state that changed.
+     * @return Functions whose enabled state changed.
      */
-    void updateFunctionStatus();
+    functions::FunctionBitmap
+        updateFunctionStatus(const types::FunctionMask stateBits);
+
+    /**
+     * @brief An api to apply a change of system state.
+     * Updates the panel functions depending on the changed bits and moves the
+     * panel back to function 01 if the function it is at gets disabled.
+     *
+     * @param[in] stateBits - Bits of the system state that changed.
+     */
+    void systemStateChanged(const types::FunctionMask stateBits);
 
     /**
      * @brief API to check remote access for a given function.
@@ -236,19 +313,15 @@ class PanelStateManager
     /**
      * @brief A structure to store information related to a particular
      * functionality. It will carry information like function number, its
-     * subrange etc. It will also store active state of a functionality at a
-     * given point of time during execution.
+     * subrange etc. Active state of the functions is kept in enabledFunctions.
      */
     struct PanelFunctionality
     {
         // serial number of the function.
         types::FunctionNumber functionNumber = 0;
 
-        // true is enabled false is disabled.
-        bool functionActiveState = false;
-
-        // debounce string.
-        std::string debouceSrc{};
+        // debounce SRC, empty if debounce is not required.
+        std::string_view debounceSrc{};
 
         // Upper range in sub function list.
         types::FunctionNumber subFunctionUpperRange;
@@ -263,6 +336,16 @@ class PanelStateManager
     // A list of functions provided by the panel.
     std::vector<PanelFunctionality> panelFunctions;
 
+    // Functions currently enabled, indexed by function number. Position of a
+    // function in panelFunctions is given by the registry index.
+    functions::FunctionBitmap enabledFunctions;
+
+    // If the enable mask of all the functions has been evaluated once.
+    bool isFunctionStatusEvaluated = false;
+
+    // Suppress display updates while a multi step navigation is applied.
+    bool isDisplayDeferred = false;
+
     // To store current state of Op-Panel. This will store the index of
     // vector panelFunctions. Fetch function number at that index to get the
     // current active functionality.
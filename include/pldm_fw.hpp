@@ -1,7 +1,18 @@
+#pragma once
+
 #include "types.hpp"
 
 #include <stdint.h>
 
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <sdbusplus/asio/connection.hpp>
 #include <vector>
 
 namespace panel
@@ -20,24 +31,93 @@ class PldmFramework
 
     /**
      * @brief Construtor
+     * @param[in] io - reference to io context class.
+     * @param[in] conn - D-Bus connection to reach pldmd on.
      */
-    PldmFramework() = default;
+    PldmFramework(std::shared_ptr<boost::asio::io_context>& io,
+                  std::shared_ptr<sdbusplus::asio::connection> conn) :
+        io_context(io), conn(conn), pldmSocket(*io), responseTimer(*io)
+    {
+    }
 
     /**
      * @brief Destructor
      */
     ~PldmFramework() = default;
 
+    /**
+     * @brief Callback to receive the completion status of a request.
+     * Status is true if PHYP responded with PLDM_SUCCESS, false otherwise.
+     */
+    using ResponseHandler = std::function<void(bool)>;
+
     /**
      * @brief Send Panel Function to PHYP.
      * This api is used to send panel function number to phyp by fetching and
      * setting the corresponding effector.
      *
+     * The instance id is requested from pldmd, then the request is sent and
+     * its response awaited, all asynchronously on the io context. Requests
+     * are sent one at a time, any request made while one is in progress is
+     * queued. The handler is always invoked from the io context, never from
+     * within this api. It receives false if the request could not be sent, no
+     * instance id and response arrived within the timeout or PHYP returned a
+     * failure completion code.
+     *
      * @param[in] funcNumber - Function number that needs to be sent to PHYP.
+     * @param[in] handler - Callback to receive the completion status.
      */
-    void sendPanelFunctionToPhyp(const types::FunctionNumber& funcNumber);
+    void sendPanelFunctionToPhyp(const types::FunctionNumber& funcNumber,
+                                 ResponseHandler handler);
+
+    /**
+     * @brief Drop the cached panel effecter details.
+     * Effecter PDRs are exchanged with the host on every host boot. This api
+     * needs to be called on host state change so that the PDR is looked up
+     * again on the next request.
+     */
+    inline void invalidateCache()
+    {
+        panelEffecter.reset();
+    }
+
+    /**
+     * @brief Complete the requests locally, as if PHYP took them.
+     * No PLDM message is sent, for an app run without a host.
+     */
+    inline void emulateHost()
+    {
+        isHostEmulated = true;
+    }
 
   private:
+    /**
+     * @brief Panel effecter details fetched from the PDR.
+     */
+    struct PanelEffecter
+    {
+        // Effecter id of the front panel effecter.
+        uint16_t effecterId = 0;
+
+        // Number of effecters in the composite effecter.
+        types::Byte effecterCount = 0;
+
+        // Position of the panel function state set in the composite effecter.
+        types::Byte panelEffecterPos = 0;
+    };
+
+    /**
+     * @brief A request to set the panel effecter.
+     */
+    struct Request
+    {
+        // Function number to send.
+        types::FunctionNumber funcNumber = 0;
+
+        // Callback to receive the completion status.
+        ResponseHandler handler;
+    };
+
     // TODO: <https://github.com/ibm-openbmc/ibm-panel/issues/57>
     // use PLDM defined header file to refer following constants.
     /** Host mctp eid */
@@ -48,11 +128,14 @@ class PldmFramework
     static constexpr auto frontPanelBoardEntityId = (uint16_t)32837;
     static constexpr auto stateIdToEnablePanelFunc = (uint16_t)32778;
 
+    /** Time to wait for the instance id and the response of PHYP. */
+    static constexpr auto responseTimeout = std::chrono::seconds(5);
+
     /**
      * @brief An api to prepare "set effecter" request packet.
      * This api prepares the message packet that needs to be sent to the PHYP.
      *
-     * @param[in] pdrs - Panel pdr data.
+     * @param[in] effecter - Panel effecter details.
      * @param[in] instanceId - instance id which uniquely identifies the
      * requested message packet. This needs to be encoded in the message packet.
      * @param[in] function - function number that needs to be sent to PHYP.
@@ -60,7 +143,7 @@ class PldmFramework
      * @return Returns a Pldm packet.
      */
     types::PldmPacket
-        prepareSetEffecterReq(const types::PdrList& pdrs,
+        prepareSetEffecterReq(const PanelEffecter& effecter,
                               types::Byte instanceId,
                               const types::FunctionNumber& function);
 
@@ -69,24 +152,90 @@ class PldmFramework
      * This api fetches host effecter id, effecter count and effecter position
      * from the panel's PDR.
      * @param[in] pdrs - Panel PDR data.
-     * @param[out] effecterId - effecter id retrieved from the PDR.
-     * @param[out] effecterCount - effecter count retrieved from the PDR.
-     * @param[out] panelEffecterPos - Position of panel effecter.
+     * @return Panel effecter details.
      */
+    PanelEffecter fetchPanelEffecterStateSet(const types::PdrList& pdrs);
 
-    void fetchPanelEffecterStateSet(const types::PdrList& pdrs,
-                                    uint16_t& effecterId,
-                                    types::Byte& effecterCount,
-                                    types::Byte& panelEffecterPos);
+    /**
+     * @brief Get the panel effecter details.
+     * Details are served from the cache if present, otherwise the PDR is
+     * fetched from PLDM and the cache is filled.
+     * @return Panel effecter details, std::nullopt if the PDR is not found.
+     */
+    std::optional<PanelEffecter> getPanelEffecter();
 
     /**
-     * @brief Get instance ID
-     * This api returns the instance id by making a dbus call to GetInstanceId
-     * api of Pldm. Instance id is to uniquely identify a message packet. This
-     * id is generated by pldm.
-     *
-     * @return one byte instance id.
+     * @brief Open the MCTP socket.
+     * The socket is opened on first use and kept open for subsequent requests.
+     * @return true if the socket is open, false otherwise.
      */
-    types::Byte getInstanceID();
+    bool openPldmSocket();
+
+    /**
+     * @brief Close the MCTP socket.
+     */
+    void closePldmSocket();
+
+    /**
+     * @brief Start the request at the front of the queue.
+     * Arms the deadline of the request and asks pldmd for its instance id.
+     * Does nothing if a request is already in progress.
+     */
+    void processNextRequest();
+
+    /**
+     * @brief Send the request at the front of the queue to PHYP.
+     * @param[in] effecter - Panel effecter details.
+     * @param[in] funcNumber - Function number to send.
+     */
+    void sendRequest(const PanelEffecter& effecter,
+                     const types::FunctionNumber funcNumber);
+
+    /**
+     * @brief Wait for the socket to turn readable and read the response.
+     * Messages which are not the response to the current request are dropped
+     * and the wait is re-armed.
+     */
+    void waitForResponse();
+
+    /**
+     * @brief Complete the current request.
+     * Posts the status to the handler of the request and moves on to the next
+     * request in the queue.
+     * @param[in] status - Completion status of the request.
+     */
+    void completeRequest(bool status);
+
+    /* Event loop the requests are serviced on */
+    std::shared_ptr<boost::asio::io_context> io_context;
+
+    /* D-Bus connection the instance ids are requested on */
+    std::shared_ptr<sdbusplus::asio::connection> conn;
+
+    /* Cached panel effecter details, valid for the current host boot. */
+    std::optional<PanelEffecter> panelEffecter;
+
+    /* MCTP socket to send the request to host. */
+    boost::asio::posix::stream_descriptor pldmSocket;
+
+    /* Deadline of the request awaiting response. */
+    boost::asio::steady_timer responseTimer;
+
+    /* Requests yet to be completed, front one is awaiting response. */
+    std::deque<Request> requests;
+
+    /* If the front request is in progress, from the instance id request to
+     * the response. */
+    bool awaitingResponse = false;
+
+    /* Instance id of the request awaiting response. */
+    types::Byte currentInstanceId = 0;
+
+    /* Sequence of the request awaiting response. Stale timer and socket
+     * completions from an earlier request are ignored based on this. */
+    uint32_t requestSequence = 0;
+
+    /* If requests complete locally with success. */
+    bool isHostEmulated = false;
 };
 } // namespace panel
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "src_record.hpp"
+#include "types.hpp"
+
+#include <cstdint>
+#include <span>
+
+namespace panel
+{
+namespace progress_code
+{
+/** @brief Length of the hexword data sent with a progress code. */
+static constexpr size_t hexWordDataLength = 72;
+
+/** @brief Offset of the hexwords in the hexword data. */
+static constexpr size_t hexWordOffset = 8;
+
+/**
+ * @brief Decode the SRC of a progress code.
+ * Progress code holds the 8 ASCII characters of the SRC, the first character
+ * in the least significant byte.
+ *
+ * @param[in] src - Progress code.
+ * @return SRC record without hexwords.
+ */
+SrcRecord decodeSrc(const uint64_t src);
+
+/**
+ * @brief Check if the hexword data sent with a progress code has hexwords.
+ * Data is filled with spaces when there are none.
+ *
+ * @param[in] hexWordData - Hexword data, of at least hexWordDataLength.
+ * @return true if hexwords are present, false otherwise.
+ */
+inline bool hasHexWords(std::span<const types::Byte> hexWordData)
+{
+    return hexWordData[0] != 0x20;
+}
+
+/**
+ * @brief Decode the hexwords sent with a progress code.
+ *
+ * 4th byte of the data is the number of valid words, the SRC word included.
+ * The hexwords, 2 to 9, follow the 8 byte header as 4 byte big endian words.
+ *
+ * @param[in] hexWordData - Hexword data, of at least hexWordDataLength.
+ * @param[in,out] record - SRC record to add the hexwords to.
+ */
+void decodeHexWords(std::span<const types::Byte> hexWordData,
+                    SrcRecord& record);
+
+} // namespace progress_code
+} // namespace panel
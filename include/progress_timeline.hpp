@@ -0,0 +1,175 @@
+#pragma once
+
+#include "src_record.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace panel
+{
+namespace timeline
+{
+/** @brief Boot id of the BMC kernel, a UUID in text form, NUL padded. */
+using BootId = std::array<char, 40>;
+
+/**
+ * @brief Get the boot id of the running BMC kernel.
+ * @return Boot id, all zero if it can't be read.
+ */
+const BootId& bmcBootId();
+
+/** @brief A progress code in the timeline. */
+struct Entry
+{
+    // Time the code was received, on the monotonic clock.
+    uint64_t timestamp;
+
+    // Boot the code belongs to.
+    uint32_t boot;
+
+    // Number of valid hexwords.
+    uint8_t hexWordCount;
+
+    // Unused.
+    std::array<uint8_t, 3> reserved;
+
+    // Characters of the SRC.
+    std::array<char, SrcRecord::srcLength> src;
+
+    // Hexwords of the SRC.
+    std::array<uint32_t, SrcRecord::maxHexWords> hexWords;
+
+    /**
+     * @brief Get the progress code of the entry.
+     * @return SRC record.
+     */
+    SrcRecord toSrcRecord() const;
+};
+
+/**
+ * @class Timeline
+ * @brief Progress codes received per boot, with the time they arrived.
+ *
+ * Codes are appended to a fixed size ring in a memory mapped file, the oldest
+ * codes are overwritten once it is full. The file outlives restarts of the
+ * app, so the timeline of a boot is kept in full across them.
+ *
+ * Till a file is opened, the timeline is kept in anonymous memory.
+ */
+class Timeline
+{
+  public:
+    /** @brief Number of codes the timeline holds. */
+    static constexpr uint32_t capacity = 4096;
+
+    /**
+     * @brief Constructor.
+     * Maps anonymous memory for the timeline.
+     */
+    Timeline();
+
+    Timeline(const Timeline&) = delete;
+    Timeline& operator=(const Timeline&) = delete;
+    Timeline(Timeline&&) = delete;
+
+    /**
+     * @brief Destructor.
+     * Unmaps the timeline and closes the file.
+     */
+    ~Timeline();
+
+    /**
+     * @brief Api to open the timeline file.
+     *
+     * The file is created if it does not exist and a file of another version
+     * or layout is reset, unless opened read only.
+     *
+     * @param[in] path - Timeline file path.
+     * @param[in] readOnly - Open only to read the timeline.
+     * @return true if the file is usable, false otherwise. The timeline held
+     * so far is kept if the file is not usable.
+     */
+    bool open(const std::string& path, const bool readOnly = false);
+
+    /**
+     * @brief Api to start the timeline of a new boot.
+     */
+    void startBoot();
+
+    /**
+     * @brief Api to append a progress code to the current boot.
+     * A new boot is started if the BMC rebooted since the last code, i.e. its
+     * boot id changed or the monotonic clock went back.
+     *
+     * @param[in] srcRecord - Progress code.
+     * @param[in] timestamp - Time the code was received.
+     * @param[in] bmcBoot - Boot id of the BMC the code was received in.
+     */
+    void append(const SrcRecord& srcRecord,
+                const std::chrono::nanoseconds timestamp =
+                    std::chrono::steady_clock::now().time_since_epoch(),
+                const BootId& bmcBoot = bmcBootId());
+
+    /**
+     * @brief Get number of codes held.
+     * @return Count of codes.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get a code.
+     * @param[in] pos - Position of the code, 0 being the oldest held.
+     * @return The code.
+     * @throw std::out_of_range if there is no code at the position.
+     */
+    Entry at(const size_t pos) const;
+
+    /**
+     * @brief Get the boot the codes are appended to.
+     * @return Boot number.
+     */
+    uint32_t currentBoot() const;
+
+  private:
+    /** @brief Start of the timeline, followed by the entries. */
+    struct Header
+    {
+        std::array<char, 8> magic;
+        uint32_t version;
+        uint32_t capacity;
+        uint32_t boot;
+        uint32_t reserved;
+        uint64_t count;
+
+        // Boot of the BMC the last code was appended in.
+        BootId bmcBoot;
+    };
+
+    /** @brief Size of the mapped timeline. */
+    static constexpr size_t mapSize = sizeof(Header) + sizeof(Entry) * capacity;
+
+    /**
+     * @brief Api to initialize the header of an empty timeline.
+     */
+    void reset();
+
+    /* Timeline file descriptor, -1 while in anonymous memory */
+    int fd = -1;
+
+    /* Mapped timeline */
+    Header* header = nullptr;
+
+    /* Entries following the header */
+    Entry* entries = nullptr;
+};
+
+/**
+ * @brief Get the progress code timeline of the app.
+ * @return Reference to the timeline.
+ */
+Timeline& store();
+
+} // namespace timeline
+} // namespace panel
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+namespace panel
+{
+/** @class RingBuffer
+ * @brief Fixed capacity buffer keeping the latest N items.
+ *
+ * Items live in a std::array, pushing to a full buffer overwrites the oldest
+ * item. No allocation is done after construction.
+ */
+template <typename T, size_t N>
+class RingBuffer
+{
+  public:
+    static_assert(N > 0, "Ring buffer needs room for an item.");
+
+    /** @brief Number of items the buffer can hold. */
+    static constexpr size_t capacity = N;
+
+    /**
+     * @brief Add an item, dropping the oldest one if full.
+     * @param[in] item - Item to add.
+     */
+    constexpr void push(const T& item)
+    {
+        items[(first + count) % N] = item;
+        if (count == N)
+        {
+            first = (first + 1) % N;
+        }
+        else
+        {
+            count++;
+        }
+    }
+
+    /**
+     * @brief Get an item.
+     * @param[in] pos - Position of the item, 0 being the oldest.
+     * @return Reference to the item.
+     * @throw std::out_of_range if there is no item at the position.
+     */
+    constexpr const T& at(const size_t pos) const
+    {
+        if (pos >= count)
+        {
+            throw std::out_of_range("Ring buffer position out of range");
+        }
+        return items[(first + pos) % N];
+    }
+
+    /**
+     * @brief Get the newest item.
+     * Buffer must not be empty.
+     * @return Reference to the item.
+     */
+    constexpr const T& back() const
+    {
+        return items[(first + count - 1) % N];
+    }
+
+    /**
+     * @brief Get number of items held.
+     * @return Count of items.
+     */
+    constexpr size_t size() const
+    {
+        return count;
+    }
+
+    /**
+     * @brief Check if the buffer holds no item.
+     * @return true if empty, false otherwise.
+     */
+    constexpr bool empty() const
+    {
+        return count == 0;
+    }
+
+    /** @brief Drop all the items. */
+    constexpr void clear()
+    {
+        first = 0;
+        count = 0;
+    }
+
+  private:
+    /* Storage of the items */
+    std::array<T, N> items{};
+
+    /* Position of the oldest item in the storage */
+    size_t first = 0;
+
+    /* Number of items held */
+    size_t count = 0;
+};
+} // namespace panel
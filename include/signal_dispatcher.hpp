@@ -0,0 +1,168 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <sdbusplus/asio/connection.hpp>
+#include <sdbusplus/bus/match.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace panel
+{
+/** @class SignalDispatcher
+ * @brief Single owner of all the D-Bus signal matches of the panel.
+ *
+ * Every match registered through the dispatcher routes its message to one
+ * dispatch routine, which looks the signal up in a flat table keyed by object
+ * path and interface and invokes the handler registered against it. Count
+ * and handler latency are recorded per registered signal.
+ */
+class SignalDispatcher
+{
+  public:
+    /* Deleted Api's*/
+    SignalDispatcher(const SignalDispatcher&) = delete;
+    SignalDispatcher& operator=(const SignalDispatcher&) = delete;
+    SignalDispatcher(SignalDispatcher&&) = delete;
+    ~SignalDispatcher() = default;
+
+    /** @brief Signals supported by the dispatcher. */
+    enum class SignalType : uint8_t
+    {
+        PROPERTIES_CHANGED,
+        INTERFACES_ADDED,
+        INTERFACES_REMOVED
+    };
+
+    /**
+     * @brief Signal handler.
+     * For PropertiesChanged, the interface name has already been read from
+     * the message when the handler is invoked, the message is positioned at
+     * the changed properties.
+     */
+    using Handler = std::function<void(sdbusplus::message_t&)>;
+
+    /**
+     * @brief Constructor.
+     * @param[in] conn - Bus connection.
+     */
+    explicit SignalDispatcher(
+        std::shared_ptr<sdbusplus::asio::connection>& conn) :
+        conn(conn)
+    {
+    }
+
+    /**
+     * @brief Register a handler for a signal.
+     *
+     * A signal, identified by its type, path and interface, can have one
+     * handler. The match rule for the signal is added to the bus on first
+     * registration, later registrations sharing the rule reuse it.
+     *
+     * @param[in] name - Name of the signal, used to report its statistics.
+     * @param[in] type - Type of the signal.
+     * @param[in] path - Object path emitting the signal.
+     * @param[in] interface - Interface whose properties are to be watched.
+     * Only used for PropertiesChanged.
+     * @param[in] handler - Handler to invoke.
+     */
+    void subscribe(const std::string& name, const SignalType type,
+                   const std::string& path, const std::string& interface,
+                   Handler handler);
+
+    /**
+     * @brief Get the statistics of all the registered signals.
+     * @return map{signal name, (count, total handler time in us, max handler
+     * time in us)}.
+     */
+    types::SignalStatistics getStatistics() const;
+
+  private:
+    /** @brief An entry of the dispatch table. */
+    struct Entry
+    {
+        // Name of the signal.
+        std::string name;
+
+        // Type of the signal.
+        SignalType type;
+
+        // Object path emitting the signal.
+        std::string path;
+
+        // Interface of the properties, empty for ObjectManager signals.
+        std::string interface;
+
+        // Handler of the signal.
+        Handler handler;
+
+        // Number of signals handled.
+        uint64_t count = 0;
+
+        // Total time spent in the handler.
+        std::chrono::microseconds totalTime{0};
+
+        // Longest time spent in the handler.
+        std::chrono::microseconds maxTime{0};
+    };
+
+    /**
+     * @brief Route a message to its handler.
+     * @param[in] type - Type of the signal.
+     * @param[in] msg - Signal message.
+     */
+    void dispatch(const SignalType type, sdbusplus::message_t& msg);
+
+    /* D-Bus connection. */
+    std::shared_ptr<sdbusplus::asio::connection> conn;
+
+    /* Dispatch table. */
+    std::vector<Entry> table;
+
+    /* Match rules added to the bus. */
+    std::vector<std::string> rules;
+
+    /* Matches of the rules, same order as rules. */
+    std::vector<std::unique_ptr<sdbusplus::bus::match_t>> matches;
+};
+
+namespace signal
+{
+/**
+ * @brief Read a property from the changed properties of a PropertiesChanged
+ * signal.
+ *
+ * Only values of the requested type are decoded, values of any other type
+ * are skipped over by the message reader.
+ *
+ * @param[in] msg - Signal message, positioned at the changed properties.
+ * @param[in] property - Name of the property.
+ * @return Value of the property, std::nullopt if it is not part of the
+ * signal.
+ */
+template <typename T>
+std::optional<T> readChangedProperty(sdbusplus::message_t& msg,
+                                     std::string_view property)
+{
+    std::vector<std::pair<std::string, std::variant<T>>> properties;
+    msg.read(properties);
+
+    for (auto& [name, value] : properties)
+    {
+        if (name == property)
+        {
+            if (auto data = std::get_if<T>(&value))
+            {
+                return std::move(*data);
+            }
+        }
+    }
+    return std::nullopt;
+}
+} // namespace signal
+} // namespace panel
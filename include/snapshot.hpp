@@ -0,0 +1,153 @@
+#pragma once
+
+#include "callout.hpp"
+#include "src_record.hpp"
+#include "types.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace panel
+{
+namespace snapshot
+{
+/**
+ * @brief Panel state kept across restarts of the app.
+ * Adding or changing a member requires a bump of the snapshot version.
+ */
+struct PanelState
+{
+    // SRC of the last 25 PELs.
+    SrcHistory pelSrcs;
+
+    // SRC and hexwords of the last PEL or progress code.
+    std::optional<SrcRecord> latestSrc;
+
+    // Callouts of the last PEL, rendered for display.
+    std::vector<CallOut> callOutList;
+
+    // System state bits not read back from D-Bus, i.e. CE and manual mode.
+    types::Byte systemState = 0;
+
+    // Function the panel is at.
+    types::FunctionNumber currentFunction = 1;
+};
+
+/**
+ * @brief Fills the state to save.
+ * @param[out] state - State of the panel.
+ */
+using Collector = std::function<void(PanelState& state)>;
+
+/**
+ * @class Store
+ * @brief Snapshot of the panel state in a memory mapped file.
+ *
+ * The file holds two slots. A snapshot is written to the slot not holding the
+ * latest one, with a sequence number and checksum, so that a write cut short
+ * leaves the previous snapshot intact. Loading picks the valid slot with the
+ * highest sequence number.
+ *
+ * Saves requested within the save delay are merged, the state is collected
+ * and written once when the delay expires.
+ */
+class Store
+{
+  public:
+    Store() = default;
+    Store(const Store&) = delete;
+    Store& operator=(const Store&) = delete;
+    Store(Store&&) = delete;
+
+    /**
+     * @brief Destructor.
+     * Unmaps and closes the snapshot file.
+     */
+    ~Store();
+
+    /**
+     * @brief Api to open the snapshot file, created if it does not exist.
+     * A file of another version or layout is reset.
+     *
+     * @param[in] path - Snapshot file path.
+     * @return true if the file is usable, false otherwise.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Api to load the latest snapshot.
+     * @return Panel state, std::nullopt if there is no valid snapshot.
+     */
+    std::optional<PanelState> load() const;
+
+    /**
+     * @brief Api to write a snapshot now.
+     * @param[in] state - Panel state to save.
+     */
+    void save(const PanelState& state);
+
+    /**
+     * @brief Api to enable saving on state change.
+     * @param[in] io - Boost asio io_context object pointer.
+     * @param[in] stateCollector - Fills the state to save.
+     */
+    void enableAutoSave(std::shared_ptr<boost::asio::io_context>& io,
+                        Collector stateCollector);
+
+    /**
+     * @brief Api to request a save of the state.
+     * Does nothing unless auto save is enabled.
+     */
+    void markDirty();
+
+  private:
+    /**
+     * @brief Get the start of a slot in the mapped file.
+     * @param[in] slot - Slot index.
+     * @return Pointer to the slot.
+     */
+    types::Byte* slotAt(const size_t slot) const;
+
+    /**
+     * @brief Api to validate a slot.
+     * @param[in] slot - Slot index.
+     * @return Sequence number of the snapshot in the slot, std::nullopt if
+     * the slot holds no valid snapshot.
+     */
+    std::optional<uint64_t> validSequence(const size_t slot) const;
+
+    /* Snapshot file descriptor */
+    int fd = -1;
+
+    /* Mapped file */
+    types::Byte* mapped = nullptr;
+
+    /* Slot holding the latest snapshot */
+    size_t latestSlot = 0;
+
+    /* Sequence number of the latest snapshot */
+    uint64_t latestSequence = 0;
+
+    /* Fills the state to save on auto save */
+    Collector collector;
+
+    /* Timer delaying the save by the save delay */
+    std::unique_ptr<boost::asio::steady_timer> saveTimer;
+
+    /* If a save is scheduled on the save timer */
+    bool isSavePending = false;
+};
+
+/**
+ * @brief Get the snapshot store of the app.
+ * @return Reference to the store.
+ */
+Store& store();
+
+} // namespace snapshot
+} // namespace panel
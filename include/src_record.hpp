@@ -0,0 +1,90 @@
+#pragma once
+
+#include "ring_buffer.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace panel
+{
+/** @brief Fixed width record of an SRC and its hexwords.
+ *
+ * Holds the 8 character SRC inline and up to 8 hexwords (hexwords 2 to 9 of
+ * the SRC) packed as integers, so records can be kept in fixed storage.
+ */
+struct SrcRecord
+{
+    /** @brief Length of an SRC. */
+    static constexpr size_t srcLength = 8;
+
+    /** @brief Number of hexwords an SRC can have. */
+    static constexpr size_t maxHexWords = 8;
+
+    /** @brief Length of the SRC followed by all its hexwords. */
+    static constexpr size_t maxTextLength = srcLength + maxHexWords * 9;
+
+    /** @brief Buffer to format a record in. */
+    using TextBuffer = std::array<char, maxTextLength>;
+
+    /** @brief Panel line showing two hexwords. */
+    using HexWordLine = std::array<char, 16>;
+
+    // Characters of the SRC, padded with spaces.
+    std::array<char, srcLength> src{};
+
+    // Hexwords of the SRC.
+    std::array<uint32_t, maxHexWords> hexWords{};
+
+    // Number of valid hexwords.
+    uint8_t hexWordCount = 0;
+
+    /**
+     * @brief Get the SRC.
+     * @return View of the SRC characters.
+     */
+    constexpr std::string_view getSrc() const
+    {
+        return std::string_view(src.data(), src.size());
+    }
+
+    /**
+     * @brief Format the SRC followed by its hexwords.
+     * Hexwords are 8 upper case hex digits, separated by a space.
+     *
+     * @param[in] buffer - Buffer to format in.
+     * @return View of the formatted text in the buffer.
+     */
+    std::string_view toText(TextBuffer& buffer) const;
+
+    /**
+     * @brief Format two consecutive hexwords as a panel line.
+     * A hexword the record does not have is displayed blank.
+     *
+     * @param[in] firstWord - Index of the first hexword, 0 for hexword 2.
+     * @param[in] line - Line to format in.
+     * @return View of the formatted line.
+     */
+    std::string_view toHexWordLine(const size_t firstWord,
+                                   HexWordLine& line) const;
+
+    /**
+     * @brief Make a record of an SRC without hexwords.
+     * @param[in] srcChars - SRC, characters past the SRC length are ignored.
+     * @return SRC record.
+     */
+    static SrcRecord fromSrc(std::string_view srcChars);
+
+    /**
+     * @brief Make a record from a PEL event id.
+     * Event id is the SRC followed by its hexwords, separated by spaces.
+     *
+     * @param[in] eventId - Event id of the PEL.
+     * @return SRC record, parsing stops at the first invalid hexword.
+     */
+    static SrcRecord fromEventId(std::string_view eventId);
+};
+
+/** @brief Last 25 SRCs, as listed by functions 63 and 64. */
+using SrcHistory = RingBuffer<SrcRecord, 25>;
+} // namespace panel
@@ -16,10 +16,12 @@ class Transport
   public:
     /**
      * A Default Constructor
-     * For testing purpose
+     * Emulated LCD panel for testing and replay. No device is opened, writes
+     * are only counted.
      */
     Transport() :
-        devPath(" "), devAddress(0), panelType(panel::types::PanelType::LCD)
+        devPath(" "), devAddress(0), panelType(panel::types::PanelType::LCD),
+        isEmulated(true)
     {
         setTransportKey(false);
     }
@@ -83,6 +85,14 @@ class Transport
         return panelType;
     }
 
+    /** @brief Method to get the number of writes made to an emulated panel.
+     * @return Count of writes.
+     */
+    inline size_t getEmulatedWriteCount() const
+    {
+        return emulatedWriteCount;
+    }
+
   private:
     /** @brief The panel's file descriptor */
     int panelFileDescriptor = -1;
@@ -110,6 +120,12 @@ class Transport
     /** @brief Base/LCD panel FRU path */
     const std::string fruPath;
 
+    /** @brief If the panel is emulated, no device is accessed. */
+    const bool isEmulated = false;
+
+    /** @brief Writes made to the emulated panel */
+    mutable size_t emulatedWriteCount = 0;
+
     /** @brief Establish panel i2c connection
      * This api establishes the i2c bus connection to the panel micro
      * controller.
@@ -55,13 +55,6 @@ using BiosBaseTable = std::vector<BiosBaseTableItem>;
 using BiosBaseTableType =
     std::map<std::string, std::variant<std::map<std::string, BiosProperty>>>;
 
-/* SystemParameterValues reference
- std::tuple<os_ipl_type, system_operating_mode, hmc_managed, fw_boot_side,
- hyp_switch>
- */
-using SystemParameterValues =
-    std::tuple<std::string, std::string, std::string, std::string, std::string>;
-
 // map{Interface : map{property:value}}
 using InterfacePropertyPair = std::pair<std::string, PropertyValueMap>;
 
@@ -71,6 +64,19 @@ using singleObjectEntry = std::pair<sdbusplus::message::object_path,
 
 using ReturnStatus = std::tuple<bool, std::string, std::string>;
 
+// map{signal name, tuple{count, total handler time, max handler time}}
+using SignalStatistics =
+    std::map<std::string, std::tuple<uint64_t, uint64_t, uint64_t>>;
+
+// tuple{progress codes received, progress codes displayed}
+using ProgressCodeStatistics = std::tuple<uint64_t, uint64_t>;
+
+// map{function number, tuple{success count, failure count, p50 latency,
+// p99 latency, max latency, last error}}
+using FunctionStatistics =
+    std::map<FunctionNumber, std::tuple<uint64_t, uint64_t, uint64_t,
+                                        uint64_t, uint64_t, std::string>>;
+
 /** Get managed objects for Network manager:
  * array{pair(network-object-paths :
  * array{pair(all-interfaces-of-that-obj-path :
@@ -1,5 +1,6 @@
 #pragma once
 #include <const.hpp>
+#include <logger.hpp>
 #include <sdbusplus/asio/object_server.hpp>
 #include <sstream>
 #include <string>
@@ -65,7 +66,7 @@ T readBusProperty(const std::string& service, const std::string& object,
     }
     catch (const sdbusplus::exception::SdBusError& e)
     {
-        std::cerr << e.what();
+        Logger::log(Logger::Subsystem::APP, Logger::ERROR, "{}", e.what());
     }
     return retVal;
 }
@@ -99,7 +100,8 @@ std::string getService(sdbusplus::bus_t& bus, const std::string& path,
 /** @brief Display on panel using transport class api.
  *
  * Method which sends the actual data to the panel's micro code using Transport
- * class write, to display the data on lcd panel.
+ * class write, to display the data on lcd panel. Used by display::Renderer,
+ * content to be displayed is to be set on the renderer.
  * TODO: Enable scroll if the lines exceeds 16 characters.
  *
  * @param[in] line1 - line 1 data that needs to be displayed.
@@ -110,13 +112,6 @@ std::string getService(sdbusplus::bus_t& bus, const std::string& path,
 void sendCurrDisplayToPanel(const std::string& line1, const std::string& line2,
                             std::shared_ptr<Transport> transport);
 
-/**
- * @brief An api to read initial values of OS IPL types, System operating
- * mode, firmware IPL type, Hypervisor type and HMC indicator.
- * @return - Values of required system parameters.
- */
-types::SystemParameterValues readSystemParameters();
-
 /** @brief Make d-bus call to "GetManagedObjects" method
  * @param[in] service - service on which the d-bus call needs to happen.
  * @param[in] object - object path.
@@ -153,13 +148,15 @@ void writeBusProperty(const std::string& serviceName,
     }
     catch (const sdbusplus::exception::SdBusError& e)
     {
-        std::cerr << e.what();
+        Logger::log(Logger::Subsystem::APP, Logger::ERROR, "{}", e.what());
         throw;
     }
 }
 
 /**
  * @brief Get next marked boot side.
+ * The value is served from the cached BIOS attributes. nextBootSide is left
+ * untouched if the boot side is not known.
  * @param[out] nextBootSide -  Next selected boot side.
  */
 void getNextBootSide(std::string& nextBootSide);
@@ -170,13 +167,6 @@ void getNextBootSide(std::string& nextBootSide);
  */
 void doLampTest(std::shared_ptr<Transport>& transport);
 
-/**
- * @brief Api to restore the current display state on panel.
- * @param[in] transport - shared pointer object to transport class to send the
- * display lines.
- */
-void restoreDisplayOnPanel(std::shared_ptr<Transport>& transport);
-
 /**
  * @brief Find and retrieve the PDR.
  * This api returns the pdr for the given terminusId, entityId and
@@ -241,6 +231,15 @@ bool getLcdPanelPresentProperty(const std::string& imValue);
  */
 types::PelPathAndSRCList geListOfPELsAndSRCs();
 
+/**
+ * @brief An API to get list of PELs and SRC from logging managed objects.
+ *
+ * @param[in] listOfPels - Managed objects of the logging service.
+ * @return The sorted list of object path and SRCs of last 25 PELs.
+ */
+types::PelPathAndSRCList
+    geListOfPELsAndSRCs(types::GetManagedObjects listOfPels);
+
 /**
  * @brief API to sort list of Pels.
  * This is required to pick last "n" number of PELs logged in the system.
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Logger
+{
+
+/**
+ * @brief Ring of binary log records in a preallocated byte buffer.
+ *
+ * A record is its varint length followed by, as a varint, the time since the
+ * previous record in us, then its payload. Only the time of the oldest record
+ * is kept whole. Writing a record evicts the oldest records it needs room
+ * for, nothing is allocated or formatted on write.
+ *
+ * A single thread writes. Readers copy the ring without locking and retry if
+ * the writer evicted records meanwhile.
+ */
+class LogBuffer
+{
+  public:
+    /** @brief Size of the ring in bytes. */
+    static constexpr size_t capacity = 8 * 1024;
+
+    /** @brief Longer payloads are dropped. */
+    static constexpr size_t maxPayloadLength = 512;
+
+    /** @brief Records copied out of the ring. */
+    struct Snapshot
+    {
+        // Time of the first record, in us since epoch.
+        uint64_t firstTimestamp;
+
+        // Length of the records copied.
+        size_t length;
+    };
+
+    /**
+     * @brief Append a record.
+     * @param[in] timestamp - Wall clock time, in us since epoch.
+     * @param[in] payload - Payload of the record.
+     */
+    void write(const uint64_t timestamp,
+               std::span<const uint8_t> payload) noexcept;
+
+    /**
+     * @brief Copy the records out of the ring, oldest first.
+     * @param[out] records - Buffer the records are copied to.
+     * @return Time of the first record and length copied, empty if the
+     *         writer kept evicting the records being copied.
+     */
+    Snapshot copy(std::array<uint8_t, capacity>& records) const;
+
+  private:
+    /**
+     * @brief Copy bytes into the ring, wrapping at its end.
+     * @param[in] pos - Position to copy to.
+     * @param[in] data - Bytes to copy.
+     */
+    void copyIn(uint64_t pos, std::span<const uint8_t> data) noexcept;
+
+    /**
+     * @brief Decode a varint in the ring.
+     * @param[in,out] pos - Position of the varint, moved past it.
+     * @return Value.
+     */
+    uint64_t readVarint(uint64_t& pos) const noexcept;
+
+    /* Records, indexed by position modulo capacity */
+    std::array<uint8_t, capacity> ring{};
+
+    /* Position past the last complete record, only increases */
+    std::atomic<uint64_t> head{0};
+
+    /* Position of the oldest record, only increases */
+    std::atomic<uint64_t> tail{0};
+
+    /* Time of the oldest record */
+    std::atomic<uint64_t> tailTimestamp{0};
+
+    /* Time of the newest record, writer only */
+    uint64_t headTimestamp = 0;
+};
+
+} // namespace Logger
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+namespace Logger
+{
+
+/** @brief Integer formatted as zero padded upper case hex. */
+struct Hex
+{
+    uint64_t value;
+    uint8_t width = 2;
+};
+
+/** @brief Bytes formatted as space separated hex, e.g. a packet. */
+struct Bytes
+{
+    std::span<const uint8_t> data;
+};
+
+/**
+ * @brief Message formatted in a caller provided buffer.
+ *
+ * Each "{}" of the format is replaced by the next argument. Integers are
+ * formatted in decimal, uint8_t included. Output past the end of the buffer
+ * is dropped.
+ */
+class MessageWriter
+{
+  public:
+    /**
+     * @brief Constructor.
+     * @param[in] buffer - Buffer to format in.
+     */
+    explicit MessageWriter(std::span<char> buffer) : buffer(buffer) {}
+
+    /**
+     * @brief Format a message.
+     * @param[in] format - Format with a "{}" per argument.
+     * @param[in] args - Arguments.
+     * @return View of the formatted message in the buffer.
+     */
+    template <typename... Args>
+    std::string_view format(std::string_view format, const Args&... args)
+    {
+        (formatNext(format, args), ...);
+        append(format);
+        return std::string_view(buffer.data(), used);
+    }
+
+  private:
+    /**
+     * @brief Copy the format up to the next placeholder, then an argument.
+     * @param[in,out] format - Format, consumed up to past the placeholder.
+     * @param[in] arg - Argument replacing the placeholder.
+     */
+    template <typename Arg>
+    void formatNext(std::string_view& format, const Arg& arg)
+    {
+        const auto pos = format.find("{}");
+        if (pos == std::string_view::npos)
+        {
+            return;
+        }
+        append(format.substr(0, pos));
+        format.remove_prefix(pos + 2);
+        formatArg(arg);
+    }
+
+    /**
+     * @brief Append text.
+     * @param[in] text - Text, truncated to the room left.
+     */
+    void append(std::string_view text)
+    {
+        const auto length = std::min(text.size(), buffer.size() - used);
+        std::copy_n(text.begin(), length, buffer.begin() + used);
+        used += length;
+    }
+
+    /**
+     * @brief Append an integer.
+     * @param[in] value - Integer.
+     * @param[in] base - Base to format in.
+     * @param[in] width - Minimum number of digits, zero padded.
+     */
+    template <typename T>
+    void appendInteger(const T value, const int base = 10, size_t width = 0)
+    {
+        char digits[24];
+        auto end = std::to_chars(std::begin(digits), std::end(digits), value,
+                                 base)
+                       .ptr;
+        std::transform(digits, end, digits,
+                       [](const char digit) {
+                           return static_cast<char>(std::toupper(digit));
+                       });
+        const size_t length = end - digits;
+        for (; width > length; --width)
+        {
+            append("0");
+        }
+        append(std::string_view(digits, length));
+    }
+
+    /**
+     * @brief Append an argument.
+     * @param[in] arg - Argument.
+     */
+    template <typename Arg>
+    void formatArg(const Arg& arg)
+    {
+        if constexpr (std::is_same_v<Arg, bool>)
+        {
+            append(arg ? "true" : "false");
+        }
+        else if constexpr (std::is_same_v<Arg, char>)
+        {
+            append(std::string_view(&arg, 1));
+        }
+        else if constexpr (std::is_integral_v<Arg>)
+        {
+            // uint8_t is a number, not a character.
+            appendInteger(+arg);
+        }
+        else if constexpr (std::is_enum_v<Arg>)
+        {
+            appendInteger(static_cast<std::underlying_type_t<Arg>>(arg));
+        }
+        else if constexpr (std::is_same_v<Arg, Hex>)
+        {
+            appendInteger(arg.value, 16, arg.width);
+        }
+        else if constexpr (std::is_same_v<Arg, Bytes>)
+        {
+            for (size_t pos = 0; pos < arg.data.size(); ++pos)
+            {
+                append(pos == 0 ? "" : " ");
+                appendInteger(arg.data[pos], 16, 2);
+            }
+        }
+        else if constexpr (std::is_convertible_v<const Arg&, std::string_view>)
+        {
+            append(std::string_view(arg));
+        }
+        else
+        {
+            static_assert(std::is_same_v<Arg, void>,
+                          "Type can not be formatted in a log message");
+        }
+    }
+
+    /* Buffer the message is formatted in */
+    std::span<char> buffer;
+
+    /* Number of characters formatted */
+    size_t used = 0;
+};
+
+} // namespace Logger
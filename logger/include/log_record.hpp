@@ -0,0 +1,266 @@
+#pragma once
+
+#include "log_format.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Logger
+{
+
+/** @brief Longest varint, of a 64 bit value. */
+constexpr size_t maxVarintLength = 10;
+
+/**
+ * @brief Encode a value as a varint, 7 bits per byte, low bits first.
+ * @param[in] value - Value to encode.
+ * @param[out] out - At least maxVarintLength bytes.
+ * @return Number of bytes written.
+ */
+inline size_t encodeVarint(uint64_t value, uint8_t* out)
+{
+    size_t length = 0;
+    while (value >= 0x80)
+    {
+        out[length++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    out[length++] = static_cast<uint8_t>(value);
+    return length;
+}
+
+/**
+ * @brief Length of a value encoded as a varint.
+ * @param[in] value - Value.
+ * @return Number of bytes.
+ */
+constexpr size_t varintLength(uint64_t value)
+{
+    size_t length = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        ++length;
+    }
+    return length;
+}
+
+/**
+ * @brief Map a signed value to unsigned, so that small negative values stay
+ * small as varints.
+ * @param[in] value - Signed value.
+ * @return Zigzag encoded value.
+ */
+constexpr uint64_t zigzagEncode(const int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^
+           static_cast<uint64_t>(value >> 63);
+}
+
+/**
+ * @brief Map a zigzag encoded value back to signed.
+ * @param[in] value - Zigzag encoded value.
+ * @return Signed value.
+ */
+constexpr int64_t zigzagDecode(const uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^
+           -static_cast<int64_t>(value & 1);
+}
+
+/** @brief Names of the log levels, indexed by level. */
+constexpr std::array<std::string_view, 4> levelNames = {"debug", "info",
+                                                        "error", "critical"};
+
+/** @brief Names of the subsystems, indexed by subsystem. */
+constexpr std::array<std::string_view, 7> subsystemNames = {
+    "app", "button", "state", "executor", "transport", "pldm", "events"};
+
+/** @brief Type of an argument in a record, precedes its value. */
+enum class ArgType : uint8_t
+{
+    UNSIGNED, // varint
+    SIGNED,   // zigzag varint
+    BOOL,     // byte
+    CHAR,     // byte
+    STRING,   // varint length, characters
+    HEX,      // width byte, varint
+    BYTES,    // varint length, bytes
+};
+
+/**
+ * @brief Encodes the arguments of a record in a caller provided buffer.
+ * Strings and bytes are truncated to the room left, arguments past the end
+ * of the buffer are dropped.
+ */
+class RecordWriter
+{
+  public:
+    /**
+     * @brief Constructor.
+     * @param[in] buffer - Buffer to encode in.
+     */
+    explicit RecordWriter(std::span<uint8_t> buffer) : buffer(buffer) {}
+
+    /**
+     * @brief Append a varint.
+     * @param[in] value - Value.
+     */
+    void addVarint(const uint64_t value)
+    {
+        if (room() >= maxVarintLength)
+        {
+            used += encodeVarint(value, buffer.data() + used);
+        }
+    }
+
+    /**
+     * @brief Append an argument with its type.
+     * @param[in] arg - Argument.
+     */
+    template <typename Arg>
+    void add(const Arg& arg)
+    {
+        if (room() < 2 + maxVarintLength)
+        {
+            return;
+        }
+
+        if constexpr (std::is_same_v<Arg, bool> || std::is_same_v<Arg, char>)
+        {
+            addType(std::is_same_v<Arg, bool> ? ArgType::BOOL
+                                              : ArgType::CHAR);
+            buffer[used++] = static_cast<uint8_t>(arg);
+        }
+        else if constexpr (std::is_integral_v<Arg> && std::is_signed_v<Arg>)
+        {
+            addType(ArgType::SIGNED);
+            addVarint(zigzagEncode(static_cast<int64_t>(arg)));
+        }
+        else if constexpr (std::is_integral_v<Arg>)
+        {
+            addType(ArgType::UNSIGNED);
+            addVarint(arg);
+        }
+        else if constexpr (std::is_enum_v<Arg>)
+        {
+            add(static_cast<std::underlying_type_t<Arg>>(arg));
+        }
+        else if constexpr (std::is_same_v<Arg, Hex>)
+        {
+            addType(ArgType::HEX);
+            buffer[used++] = arg.width;
+            addVarint(arg.value);
+        }
+        else if constexpr (std::is_same_v<Arg, Bytes>)
+        {
+            addType(ArgType::BYTES);
+            addData(arg.data);
+        }
+        else if constexpr (std::is_convertible_v<const Arg&, std::string_view>)
+        {
+            const std::string_view text(arg);
+            addType(ArgType::STRING);
+            addData(std::span(reinterpret_cast<const uint8_t*>(text.data()),
+                              text.size()));
+        }
+        else
+        {
+            static_assert(std::is_same_v<Arg, void>,
+                          "Type can not be logged in a record");
+        }
+    }
+
+    /**
+     * @brief Get the encoded bytes.
+     * @return View of the encoded bytes in the buffer.
+     */
+    std::span<const uint8_t> data() const
+    {
+        return buffer.first(used);
+    }
+
+  private:
+    /** @brief Bytes left in the buffer. */
+    size_t room() const
+    {
+        return buffer.size() - used;
+    }
+
+    /**
+     * @brief Append the type of an argument.
+     * @param[in] type - Type.
+     */
+    void addType(const ArgType type)
+    {
+        buffer[used++] = static_cast<uint8_t>(type);
+    }
+
+    /**
+     * @brief Append bytes with their length, truncated to the room left.
+     * @param[in] data - Bytes.
+     */
+    void addData(std::span<const uint8_t> data)
+    {
+        const auto length = std::min(data.size(), room() - maxVarintLength);
+        addVarint(length);
+        std::copy_n(data.begin(), length, buffer.begin() + used);
+        used += length;
+    }
+
+    /* Buffer the arguments are encoded in */
+    std::span<uint8_t> buffer;
+
+    /* Number of bytes encoded */
+    size_t used = 0;
+};
+
+/**
+ * @brief Start of a log dump.
+ *
+ * Followed by the table of log sites and the records, oldest first.
+ * A site is its level byte, subsystem byte, then as varints its line, file
+ * name length and format length, followed by the file name and format.
+ * A record is its varint length followed by, as varints, the time since the
+ * previous record in us, zigzag encoded as the clock may step back, and the
+ * index of its site, then its arguments.
+ */
+struct DumpHeader
+{
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t siteCount;
+
+    // Time of the first record, in us since epoch.
+    uint64_t firstTimestamp;
+
+    // Length of the records.
+    uint32_t length;
+
+    // Records not kept as the site table was full.
+    uint32_t droppedRecords;
+};
+
+/** @brief Identifies a log dump. */
+constexpr std::array<char, 8> dumpMagic{'P', 'N', 'L', 'L', 'O', 'G', '\0',
+                                        '\0'};
+
+/** @brief Version of the dump format. */
+constexpr uint32_t dumpVersion = 1;
+
+/**
+ * @brief Decode a log dump to text.
+ * @param[in] dump - Content of the dump file.
+ * @return A line per record, oldest first, followed by a line with the count
+ *         of dropped records if any.
+ * @throw std::runtime_error if the dump is not valid.
+ */
+std::vector<std::string> decodeDump(std::span<const uint8_t> dump);
+
+} // namespace Logger
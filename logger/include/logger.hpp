@@ -1,38 +1,200 @@
 #pragma once
 
-#include <filesystem>
-#include <iostream>
-#include <list>
+#include "log_buffer.hpp"
+#include "log_format.hpp"
+#include "log_record.hpp"
+
+#include <array>
+#include <cstdint>
 #include <map>
 #include <source_location>
-#include <sstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace Logger
 {
 
 enum Loglevel
 {
+    DEBUG,
     INFO,
+    ERROR,
     CRITICAL
 };
 
+static_assert(levelNames.size() == Loglevel::CRITICAL + 1);
+
+/** @brief Parts of the daemon, each logging at its own level. */
+enum class Subsystem : uint8_t
+{
+    APP,       // Startup, persistence and D-Bus requests.
+    BUTTON,    // Panel button events.
+    STATE,     // Panel state machine.
+    EXECUTOR,  // Execution of the panel functions.
+    TRANSPORT, // Writes to the panel and its display.
+    PLDM,      // PLDM messages to the host.
+    EVENTS,    // System events, PELs and progress codes.
+    COUNT
+};
+
+static_assert(subsystemNames.size() == static_cast<size_t>(Subsystem::COUNT));
+
+/**
+ * @brief Minimum level logged by each subsystem, INFO by default.
+ * Read on every log call, use setLevel or setLevels to change it.
+ */
+inline auto subsystemLevels = [] {
+    std::array<Loglevel, static_cast<size_t>(Subsystem::COUNT)> levels;
+    levels.fill(Loglevel::INFO);
+    return levels;
+}();
+
+/**
+ * @brief Key of a log site, FNV-1a hash of its location and format.
+ * @param[in] file - File name of the site.
+ * @param[in] line - Line of the site.
+ * @param[in] format - Format of the site.
+ * @return Key.
+ */
+constexpr uint64_t siteKey(std::string_view file, const uint32_t line,
+                           std::string_view format)
+{
+    uint64_t key = 0xCBF29CE484222325;
+    const auto mix = [&key](const uint8_t byte) {
+        key = (key ^ byte) * 0x100000001B3;
+    };
+    for (const auto c : file)
+    {
+        mix(static_cast<uint8_t>(c));
+    }
+    for (unsigned shift = 0; shift < 32; shift += 8)
+    {
+        mix(static_cast<uint8_t>(line >> shift));
+    }
+    for (const auto c : format)
+    {
+        mix(static_cast<uint8_t>(c));
+    }
+    return key;
+}
+
+/**
+ * @brief Format of a log message and the location of the log call.
+ * Captures the location implicitly, as the format is the first argument
+ * converted at the call site. The format must be a constant, the key of the
+ * site is computed at compile time.
+ */
+struct Format
+{
+    /**
+     * @brief Constructor.
+     * @param[in] text - Format, with a "{}" per argument.
+     * @param[in] location - Location of the log call.
+     */
+    template <typename Text>
+        requires std::is_convertible_v<const Text&, std::string_view>
+    consteval Format(const Text& text, const std::source_location& location =
+                                           std::source_location::current()) :
+        text(text),
+        location(location),
+        key(siteKey(location.file_name(), location.line(), this->text))
+    {
+    }
+
+    std::string_view text;
+    std::source_location location;
+    uint64_t key;
+};
+
+/**
+ * @brief Maximum number of log sites. Records of later sites are not kept in
+ * the buffer, they are counted in the dump.
+ */
+constexpr size_t maxSites = 512;
+
+/** @brief Longer messages printed to the journal are truncated. */
+constexpr size_t maxMessageLength = 512;
+
+/** @brief Default path of the log dump. */
+constexpr auto logDumpPath = "/var/lib/vpd/panellog.bin";
+
+/**
+ * @brief Check if a subsystem logs a level.
+ * @param[in] subsystem - Subsystem.
+ * @param[in] level - Level of the message.
+ * @return true if the message is to be logged.
+ */
+inline bool isEnabled(const Subsystem subsystem, const Loglevel level)
+{
+    return level >= subsystemLevels[static_cast<size_t>(subsystem)];
+}
+
+/**
+ * @brief Set the minimum level logged by a subsystem.
+ * @param[in] subsystem - Subsystem.
+ * @param[in] level - Minimum level.
+ */
+void setLevel(const Subsystem subsystem, const Loglevel level);
+
+/**
+ * @brief Get the level of every subsystem.
+ * @return Map of subsystem name to level name, e.g. "button" to "debug".
+ */
+std::map<std::string, std::string> getLevels();
+
+/**
+ * @brief Set the level of subsystems by name.
+ * Nothing is changed if a subsystem or level name is unknown.
+ *
+ * @param[in] levels - Map of subsystem name to level name.
+ * @return true if the levels are set, false otherwise.
+ */
+bool setLevels(const std::map<std::string, std::string>& levels);
+
 // Maximum size of buffer is 8k bytes
-const size_t maxBufferSize = 8000;
-inline std::list<std::string> circularBuffer;
+const size_t maxBufferSize = LogBuffer::capacity;
+
+/**
+ *@brief Get the index of a log site, registering it on first use
+ *
+ *@param[in] subsystem - Subsystem logging at the site
+ *@param[in] level - loglevel of the site
+ *@param[in] format - Format and location of the site
+ *@return Index of the site, maxSites if the site table is full, the record
+ *        is then counted as dropped
+ */
+size_t registerSite(const Subsystem subsystem, const Loglevel level,
+                    const Format& format);
+
+/**
+ *@brief Appends a record to the buffer, timestamped now
+ *
+ *@param[in] payload - Site index and arguments of the record
+ */
+void writeRecord(std::span<const uint8_t> payload);
+
+/**
+ *@brief Prints a message to the journal
+ *
+ *@param[in] message - Formatted message
+ */
+void printMessage(std::string_view message);
 
 /**
  *@brief Appends data to the buffer
  *
  *This API is called to log message to the buffer.
- *It checks the log level and appends information like
- *line number, file name, timestamp to the message.
+ *It stores the message as the argument of a site of its location, with a
+ *timestamp.
  *
  *@param[in] level - loglevel of the message
  *@param[in] message - Information to be logged
  *@param[in] location - object of the source_location class
  */
 void logMessage(
-    const Loglevel level, const std::string& message,
+    const Loglevel level, std::string_view message,
     const std::source_location& location = std::source_location::current());
 
 /**
@@ -42,17 +204,59 @@ void logMessage(
  *@param[in] loaction - object of the source_location class
  */
 void logMessage(
-    const std::string& message,
+    std::string_view message,
     const std::source_location& location = std::source_location::current());
 
 /**
- * @brief Fetches specified number of logs and dump to a file
+ *@brief Appends a message of a subsystem
+ *
+ *The record holds the index of the site and the arguments, typed. It is
+ *formatted only when a dump is decoded. Messages of level ERROR and above
+ *are formatted and printed to the journal as well.
+ *
+ *@param[in] subsystem - Subsystem logging the message
+ *@param[in] level - loglevel of the message
+ *@param[in] format - Format of the message, with a "{}" per argument
+ *@param[in] args - Arguments of the message
+ */
+template <typename... Args>
+void log(const Subsystem subsystem, const Loglevel level, Format format,
+         const Args&... args)
+{
+    if (!isEnabled(subsystem, level))
+    {
+        return;
+    }
+
+    // Errors are rare, they reach the journal as well.
+    if (level >= Loglevel::ERROR)
+    {
+        std::array<char, maxMessageLength> buffer;
+        printMessage(MessageWriter(buffer).format(format.text, args...));
+    }
+
+    const auto site = registerSite(subsystem, level, format);
+    if (site == maxSites)
+    {
+        return;
+    }
+
+    std::array<uint8_t, LogBuffer::maxPayloadLength> payload;
+    RecordWriter record(payload);
+    record.addVarint(site);
+    (record.add(args), ...);
+    writeRecord(record.data());
+}
+
+/**
+ * @brief Dump the logs to a file
  *
- * The API fetches the specified number of logs from the buffer
- * and dumps the logs into a file.
+ * Writes the site table and the records of the buffer, binary, in a single
+ * write. paneltool decodes the dump to text.
  *
- * @param[in] noOfLogs - Number of logs to be fetched
+ * @param[in] path - Path of the dump
+ * @return true if the dump is written, false otherwise.
  */
-void fetchNLogs(size_t noOfLogs);
+bool dumpLogs(const std::string& path = logDumpPath);
 
 }; // namespace Logger
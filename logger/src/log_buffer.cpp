@@ -0,0 +1,120 @@
+#include "log_buffer.hpp"
+
+#include "log_record.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Logger
+{
+
+void LogBuffer::copyIn(const uint64_t pos,
+                       std::span<const uint8_t> data) noexcept
+{
+    const auto offset = pos % ring.size();
+    const auto first = std::min(data.size(), ring.size() - offset);
+    std::memcpy(ring.data() + offset, data.data(), first);
+    std::memcpy(ring.data(), data.data() + first, data.size() - first);
+}
+
+uint64_t LogBuffer::readVarint(uint64_t& pos) const noexcept
+{
+    uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        const auto byte = ring[pos++ % ring.size()];
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            break;
+        }
+    }
+    return value;
+}
+
+void LogBuffer::write(const uint64_t timestamp,
+                      std::span<const uint8_t> payload) noexcept
+{
+    if (payload.size() > maxPayloadLength)
+    {
+        return;
+    }
+
+    // Only this thread moves head and tail, relaxed loads see its own stores.
+    const auto writePos = head.load(std::memory_order_relaxed);
+    auto oldest = tail.load(std::memory_order_relaxed);
+    auto oldestTimestamp = tailTimestamp.load(std::memory_order_relaxed);
+    if (writePos == oldest)
+    {
+        headTimestamp = timestamp;
+        oldestTimestamp = timestamp;
+    }
+
+    // The wall clock may step back, deltas are signed.
+    std::array<uint8_t, maxVarintLength> delta;
+    const auto deltaLength = encodeVarint(
+        zigzagEncode(static_cast<int64_t>(timestamp - headTimestamp)),
+        delta.data());
+    std::array<uint8_t, maxVarintLength> length;
+    const auto lengthLength =
+        encodeVarint(deltaLength + payload.size(), length.data());
+    const auto size = lengthLength + deltaLength + payload.size();
+
+    while (writePos + size - oldest > capacity)
+    {
+        const auto evicted = readVarint(oldest);
+        oldest += evicted;
+        if (oldest == writePos)
+        {
+            oldestTimestamp = timestamp;
+        }
+        else
+        {
+            auto next = oldest;
+            readVarint(next);
+            oldestTimestamp +=
+                static_cast<uint64_t>(zigzagDecode(readVarint(next)));
+        }
+    }
+
+    // Readers check the tail after copying, the evicted bytes are published
+    // as stale before they are overwritten. The tail time is published with
+    // the tail.
+    tailTimestamp.store(oldestTimestamp, std::memory_order_relaxed);
+    tail.store(oldest, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    copyIn(writePos, std::span(length).first(lengthLength));
+    copyIn(writePos + lengthLength, std::span(delta).first(deltaLength));
+    copyIn(writePos + lengthLength + deltaLength, payload);
+    headTimestamp = timestamp;
+    head.store(writePos + size, std::memory_order_release);
+}
+
+LogBuffer::Snapshot
+    LogBuffer::copy(std::array<uint8_t, capacity>& records) const
+{
+    for (int attempt = 0; attempt < 3; ++attempt)
+    {
+        const auto begin = tail.load(std::memory_order_acquire);
+        const auto firstTimestamp =
+            tailTimestamp.load(std::memory_order_relaxed);
+        const auto end = head.load(std::memory_order_acquire);
+
+        const auto offset = begin % ring.size();
+        const auto length = end - begin;
+        const auto first = std::min(length, ring.size() - offset);
+        std::memcpy(records.data(), ring.data() + offset, first);
+        std::memcpy(records.data() + first, ring.data(), length - first);
+
+        // Records evicted while copying may have been overwritten.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (tail.load(std::memory_order_relaxed) == begin)
+        {
+            return {firstTimestamp, length};
+        }
+    }
+    return {0, 0};
+}
+
+} // namespace Logger
@@ -0,0 +1,271 @@
+#include "log_record.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <stdexcept>
+
+namespace Logger
+{
+
+namespace
+{
+/** @brief Reads the fields of a dump, throws past its end. */
+class Reader
+{
+  public:
+    /**
+     * @brief Constructor.
+     * @param[in] data - Bytes to read.
+     */
+    explicit Reader(std::span<const uint8_t> data) : data(data) {}
+
+    /**
+     * @brief Check if all the bytes are read.
+     * @return true if at the end.
+     */
+    bool atEnd() const
+    {
+        return pos == data.size();
+    }
+
+    /**
+     * @brief Read bytes.
+     * @param[in] length - Number of bytes.
+     * @return View of the bytes.
+     */
+    std::span<const uint8_t> bytes(const uint64_t length)
+    {
+        if (length > data.size() - pos)
+        {
+            throw std::runtime_error("Log dump is truncated");
+        }
+        const auto bytes = data.subspan(pos, length);
+        pos += length;
+        return bytes;
+    }
+
+    /**
+     * @brief Read a byte.
+     * @return Byte.
+     */
+    uint8_t byte()
+    {
+        return bytes(1)[0];
+    }
+
+    /**
+     * @brief Read a varint.
+     * @return Value.
+     */
+    uint64_t varint()
+    {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            const auto next = byte();
+            value |= static_cast<uint64_t>(next & 0x7F) << shift;
+            if ((next & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+        throw std::runtime_error("Log dump has a bad varint");
+    }
+
+    /**
+     * @brief Read a length followed by as many characters.
+     * @return View of the characters.
+     */
+    std::string_view text()
+    {
+        const auto text = bytes(varint());
+        return std::string_view(reinterpret_cast<const char*>(text.data()),
+                                text.size());
+    }
+
+  private:
+    /* Bytes to read */
+    std::span<const uint8_t> data;
+
+    /* Position of the next byte */
+    size_t pos = 0;
+};
+
+/** @brief A log site read from the dump. */
+struct Site
+{
+    uint8_t level;
+    uint8_t subsystem;
+    uint64_t line;
+    std::string_view file;
+    std::string_view format;
+};
+
+/**
+ * @brief Append an integer as zero padded upper case hex.
+ * @param[in,out] text - Text to append to.
+ * @param[in] value - Integer.
+ * @param[in] width - Minimum number of digits.
+ */
+void appendHex(std::string& text, const uint64_t value, const int width)
+{
+    char digits[24];
+    const auto length = std::snprintf(digits, sizeof(digits), "%0*llX", width,
+                                      static_cast<unsigned long long>(value));
+    text.append(digits, length);
+}
+
+/**
+ * @brief Decode the next argument of a record to text.
+ * @param[in,out] record - Record, read past the argument.
+ * @param[in,out] text - Text to append the argument to.
+ */
+void appendArg(Reader& record, std::string& text)
+{
+    switch (static_cast<ArgType>(record.byte()))
+    {
+        case ArgType::UNSIGNED:
+            text += std::to_string(record.varint());
+            break;
+        case ArgType::SIGNED:
+            text += std::to_string(zigzagDecode(record.varint()));
+            break;
+        case ArgType::BOOL:
+            text += record.byte() ? "true" : "false";
+            break;
+        case ArgType::CHAR:
+            text += static_cast<char>(record.byte());
+            break;
+        case ArgType::STRING:
+            text += record.text();
+            break;
+        case ArgType::HEX:
+        {
+            const auto width = record.byte();
+            appendHex(text, record.varint(), width);
+            break;
+        }
+        case ArgType::BYTES:
+        {
+            const auto bytes = record.bytes(record.varint());
+            for (size_t pos = 0; pos < bytes.size(); ++pos)
+            {
+                text += (pos == 0) ? "" : " ";
+                appendHex(text, bytes[pos], 2);
+            }
+            break;
+        }
+        default:
+            throw std::runtime_error("Log dump has a bad argument type");
+    }
+}
+
+/**
+ * @brief Format a timestamp as "YYYY-MM-DD HH:MM:SS.uuuuuu".
+ * @param[in] microseconds - Time since epoch, in us.
+ * @return Formatted timestamp.
+ */
+std::string timestamp(const uint64_t microseconds)
+{
+    const auto seconds = static_cast<time_t>(microseconds / 1000000);
+    tm time{};
+    gmtime_r(&seconds, &time);
+    char text[40];
+    auto length = std::strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", &time);
+    length += std::snprintf(text + length, sizeof(text) - length, ".%06u",
+                            static_cast<unsigned>(microseconds % 1000000));
+    return std::string(text, length);
+}
+} // namespace
+
+std::vector<std::string> decodeDump(std::span<const uint8_t> dump)
+{
+    Reader reader(dump);
+    DumpHeader header;
+    std::memcpy(&header, reader.bytes(sizeof(header)).data(), sizeof(header));
+    if (header.magic != dumpMagic || header.version != dumpVersion)
+    {
+        throw std::runtime_error("Not a panel log dump");
+    }
+
+    std::vector<Site> sites;
+    for (uint32_t index = 0; index < header.siteCount; ++index)
+    {
+        Site site{};
+        site.level = reader.byte();
+        site.subsystem = reader.byte();
+        site.line = reader.varint();
+        const auto fileLength = reader.varint();
+        const auto formatLength = reader.varint();
+        const auto file = reader.bytes(fileLength);
+        const auto format = reader.bytes(formatLength);
+        site.file = std::string_view(
+            reinterpret_cast<const char*>(file.data()), file.size());
+        site.format = std::string_view(
+            reinterpret_cast<const char*>(format.data()), format.size());
+        sites.push_back(site);
+    }
+
+    Reader records(reader.bytes(header.length));
+    std::vector<std::string> lines;
+    auto time = header.firstTimestamp;
+    while (!records.atEnd())
+    {
+        Reader record(records.bytes(records.varint()));
+
+        // Time of the first record is in the header.
+        const auto delta = zigzagDecode(record.varint());
+        time += lines.empty() ? 0 : static_cast<uint64_t>(delta);
+
+        const auto index = record.varint();
+        if (index >= sites.size())
+        {
+            throw std::runtime_error("Log dump has a bad site index");
+        }
+        const auto& site = sites[index];
+
+        std::string level(site.level < levelNames.size()
+                              ? levelNames[site.level]
+                              : "unknown");
+        std::transform(level.begin(), level.end(), level.begin(),
+                       [](const char c) {
+                           return static_cast<char>(std::toupper(c));
+                       });
+        const auto subsystem = site.subsystem < subsystemNames.size()
+                                   ? subsystemNames[site.subsystem]
+                                   : "unknown";
+        const auto slash = site.file.rfind('/');
+        const auto file = (slash == std::string_view::npos)
+                              ? site.file
+                              : site.file.substr(slash + 1);
+
+        std::string line = timestamp(time) + " [" + level + "] " +
+                           std::string(subsystem) + " : " + std::string(file) +
+                           ":" + std::to_string(site.line) + " - ";
+
+        // Arguments dropped from a full record leave their placeholder.
+        auto format = site.format;
+        for (auto pos = format.find("{}");
+             pos != std::string_view::npos && !record.atEnd();
+             pos = format.find("{}"))
+        {
+            line += format.substr(0, pos);
+            format.remove_prefix(pos + 2);
+            appendArg(record, line);
+        }
+        line += format;
+        lines.push_back(std::move(line));
+    }
+
+    if (header.droppedRecords != 0)
+    {
+        lines.push_back(std::to_string(header.droppedRecords) +
+                        " records dropped, the log site table is full");
+    }
+    return lines;
+}
+
+} // namespace Logger
@@ -1,92 +1,236 @@
 #include "logger.hpp"
 
-#include <ctime>
-#include <fstream>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <vector>
 
 namespace Logger
 {
 
-static std::map<Loglevel, std::string> logLevelMap = {
-    {Loglevel::INFO, "INFO"}, {Loglevel::CRITICAL, "CRITICAL"}};
+namespace
+{
+/** @brief A location logging a format, with its level. */
+struct Site
+{
+    uint64_t key;
+    std::string_view file;
+    uint32_t line;
+    Subsystem subsystem;
+    Loglevel level;
+    std::string_view format;
+};
+
+/* Sites, indexed by the site index of the records */
+std::array<Site, maxSites> sites;
+size_t siteCount = 0;
+
+/* Site index + 1 by key, open addressing, 0 is free */
+std::array<uint16_t, 2 * maxSites> siteSlots{};
+
+/* Records not kept as their site did not fit the site table */
+uint32_t droppedRecords = 0;
+
+/**
+ * @brief Find a site, registering it if not found.
+ * @param[in] site - Site, key included.
+ * @return Index of the site, maxSites if the site table is full.
+ */
+size_t findSite(const Site& site)
+{
+    // Half the slots at most are used, a free slot ends the probe.
+    for (auto slot = site.key % siteSlots.size();;
+         slot = (slot + 1) % siteSlots.size())
+    {
+        if (siteSlots[slot] == 0)
+        {
+            if (siteCount == maxSites)
+            {
+                ++droppedRecords;
+                return maxSites;
+            }
+            sites[siteCount] = site;
+            siteSlots[slot] = static_cast<uint16_t>(++siteCount);
+            return siteCount - 1;
+        }
 
-size_t byteCount = 0;
-const std::string logFilePath = "/var/lib/vpd/panellog.log";
+        const auto index = siteSlots[slot] - 1;
+        const auto& found = sites[index];
+        if (found.key == site.key && found.line == site.line &&
+            found.subsystem == site.subsystem && found.level == site.level)
+        {
+            return index;
+        }
+    }
+}
 
 /**
- * @brief Generates a timestamp string
+ * @brief Ring holding the log records.
  *
- * Generates a timestamp string representing the current time
- * in the format "YYYY-MM-DD HH:MM:SS"
+ * @return Log buffer of the process.
+ */
+LogBuffer& logBuffer()
+{
+    static LogBuffer buffer;
+    return buffer;
+}
+
+/**
+ * @brief Find the position of a name in a list of names.
  *
- * @return A string containing the formatted timestamp
+ * @param[in] names - List of names.
+ * @param[in] name - Name to find.
+ * @return Position of the name, size of the list if not found.
  */
-static std::string timestamp()
+template <typename Names>
+size_t findName(const Names& names, std::string_view name)
 {
-    time_t t = time(nullptr);
-    tm Time{};
-    gmtime_r(&t, &Time);
-    std::string timeStamp;
-    timeStamp.resize(30, '\0');
-    size_t currentTime = strftime(timeStamp.data(), timeStamp.size(),
-                                  "%Y-%m-%d %H:%M:%S", &Time);
-    timeStamp.resize(currentTime);
-    return timeStamp;
+    return std::find(names.begin(), names.end(), name) - names.begin();
 }
+} // namespace
 
-void logMessage(const Loglevel level, const std::string& message,
-                const std::source_location& location)
+void setLevel(const Subsystem subsystem, const Loglevel level)
+{
+    subsystemLevels[static_cast<size_t>(subsystem)] = level;
+}
+
+std::map<std::string, std::string> getLevels()
 {
-    std::string tmpString =
-        timestamp() + " [" + logLevelMap[level] + "]" + " : " +
-        std::filesystem::path(location.file_name()).filename().string() + ":" +
-        std::to_string(location.line()) + " - " + message + "\n";
-    while (byteCount + tmpString.size() > maxBufferSize)
+    std::map<std::string, std::string> levels;
+    for (size_t subsystem = 0; subsystem < subsystemNames.size(); ++subsystem)
     {
-        byteCount = byteCount - (*circularBuffer.begin()).size();
-        circularBuffer.erase(circularBuffer.begin());
+        levels.emplace(subsystemNames[subsystem],
+                       levelNames[subsystemLevels[subsystem]]);
     }
-    if (Loglevel::INFO == level)
+    return levels;
+}
+
+bool setLevels(const std::map<std::string, std::string>& levels)
+{
+    for (const auto& [subsystem, level] : levels)
     {
-        circularBuffer.push_back(tmpString);
-        byteCount = byteCount + tmpString.size();
+        if (findName(subsystemNames, subsystem) == subsystemNames.size() ||
+            findName(levelNames, level) == levelNames.size())
+        {
+            return false;
+        }
     }
+
+    for (const auto& [subsystem, level] : levels)
+    {
+        subsystemLevels[findName(subsystemNames, subsystem)] =
+            static_cast<Loglevel>(findName(levelNames, level));
+    }
+    return true;
+}
+
+size_t registerSite(const Subsystem subsystem, const Loglevel level,
+                    const Format& format)
+{
+    return findSite({format.key, format.location.file_name(),
+                     format.location.line(), subsystem, level, format.text});
+}
+
+void writeRecord(std::span<const uint8_t> payload)
+{
+    const auto now = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch());
+    logBuffer().write(static_cast<uint64_t>(now.count()), payload);
 }
 
-void logMessage(const std::string& message,
+void printMessage(std::string_view message)
+{
+    std::cerr << message << std::endl;
+}
+
+void logMessage(const Loglevel level, std::string_view message,
                 const std::source_location& location)
+{
+    if (level >= Loglevel::ERROR)
+    {
+        printMessage(message);
+    }
+
+    constexpr std::string_view format = "{}";
+    const auto site =
+        findSite({siteKey(location.file_name(), location.line(), format),
+                  location.file_name(), location.line(), Subsystem::APP,
+                  level, format});
+    if (site == maxSites)
+    {
+        return;
+    }
+
+    std::array<uint8_t, LogBuffer::maxPayloadLength> payload;
+    RecordWriter record(payload);
+    record.addVarint(site);
+    record.add(message);
+    writeRecord(record.data());
+}
+
+void logMessage(std::string_view message, const std::source_location& location)
 {
     logMessage(Loglevel::INFO, message, location);
 }
 
-void fetchNLogs(size_t noOfLogs)
+bool dumpLogs(const std::string& path)
 {
-    try
+    std::array<uint8_t, LogBuffer::capacity> records;
+    const auto snapshot = logBuffer().copy(records);
+
+    std::vector<uint8_t> siteTable;
+    for (size_t index = 0; index < siteCount; ++index)
     {
-        std::fstream logfile(logFilePath, std::ios::trunc | std::ios::out);
-        if (!logfile.is_open())
-        {
-            throw std::runtime_error("Error opening " + logFilePath + "file");
-        }
+        const auto& site = sites[index];
+        const auto offset = siteTable.size();
+        siteTable.resize(offset + 2 + 3 * maxVarintLength + site.file.size() +
+                         site.format.size());
 
-        if (noOfLogs > circularBuffer.size())
-        {
-            noOfLogs = circularBuffer.size();
-        }
+        auto out = siteTable.data() + offset;
+        *out++ = static_cast<uint8_t>(site.level);
+        *out++ = static_cast<uint8_t>(site.subsystem);
+        out += encodeVarint(site.line, out);
+        out += encodeVarint(site.file.size(), out);
+        out += encodeVarint(site.format.size(), out);
+        out = std::copy(site.file.begin(), site.file.end(), out);
+        out = std::copy(site.format.begin(), site.format.end(), out);
+        siteTable.resize(out - siteTable.data());
+    }
 
-        auto iterator = circularBuffer.begin();
-        std::advance(iterator, circularBuffer.size() - noOfLogs);
-        while (iterator != circularBuffer.end())
-        {
-            logfile << *iterator;
-            iterator++;
-        }
+    DumpHeader header{dumpMagic,
+                      dumpVersion,
+                      static_cast<uint32_t>(siteCount),
+                      snapshot.firstTimestamp,
+                      static_cast<uint32_t>(snapshot.length),
+                      droppedRecords};
 
-        logfile.close();
+    std::array<iovec, 3> parts{
+        {{&header, sizeof(header)},
+         {siteTable.data(), siteTable.size()},
+         {records.data(), snapshot.length}}};
+    const auto size = sizeof(header) + siteTable.size() + snapshot.length;
+
+    const int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                        0644);
+    if (fd < 0)
+    {
+        std::cerr << "Error opening " << path << " file" << std::endl;
+        return false;
     }
-    catch (const std::exception& e)
+
+    const auto written = writev(fd, parts.data(), parts.size());
+    close(fd);
+    if (written < 0 || static_cast<size_t>(written) != size)
     {
-        std::cerr << "Exception: " << e.what() << std::endl;
+        std::cerr << "Error writing " << path << " file" << std::endl;
+        return false;
     }
+    return true;
 }
 
 } // namespace Logger
@@ -0,0 +1,60 @@
+#include "bios_attributes.hpp"
+
+#include "logger.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+
+namespace panel
+{
+namespace bios
+{
+size_t AttributeTracker::lookup(std::string_view name)
+{
+    return std::distance(
+        attributeNames.begin(),
+        std::find(attributeNames.begin(), attributeNames.end(), name));
+}
+
+bool AttributeTracker::refresh()
+{
+    const auto retVal = utils::readBusProperty<
+        std::variant<types::BiosBaseTable>>(
+        "xyz.openbmc_project.BIOSConfigManager",
+        "/xyz/openbmc_project/bios_config/manager",
+        "xyz.openbmc_project.BIOSConfig.Manager", "BaseBIOSTable");
+
+    if (const auto baseBiosTable =
+            std::get_if<types::BiosBaseTable>(&retVal))
+    {
+        // An empty table means BIOS config manager is not populated yet. Keep
+        // the cache unpopulated so that the next reader tries again.
+        if (!baseBiosTable->empty())
+        {
+            update(*baseBiosTable);
+            return true;
+        }
+    }
+
+    Logger::log(Logger::Subsystem::APP, Logger::ERROR,
+                "Failed to read BIOS base table");
+    return false;
+}
+
+const std::string& AttributeTracker::get(const Attribute attr)
+{
+    if (!populated)
+    {
+        refresh();
+    }
+    return values[static_cast<size_t>(attr)];
+}
+
+AttributeTracker& attributes()
+{
+    static AttributeTracker tracker;
+    return tracker;
+}
+
+} // namespace bios
+} // namespace panel
@@ -1,5 +1,7 @@
 #include "bus_handler.hpp"
 
+#include "logger.hpp"
+
 #include <string>
 
 #include "utils.cpp"
@@ -9,30 +11,19 @@ namespace panel
 void BusHandler::display(const std::string& displayLine1,
                          const std::string& displayLine2)
 {
-    utils::sendCurrDisplayToPanel(displayLine1, displayLine2, transport);
+    executor->getRenderer().show(display::Layer::OVERLAY, displayLine1,
+                                 displayLine2);
 }
 
 void BusHandler::triggerPanelLampTest(const bool state)
 {
-    if (state)
-    {
-        utils::doLampTest(transport);
-    }
-    else
-    {
-        utils::restoreDisplayOnPanel(transport);
-    }
+    executor->getRenderer().setLampTest(state);
 }
 
 void BusHandler::toggleFunctionState(types::FunctionalityList functionBitMap)
 {
-    std::cout << "Bitmap received: ";
-    for (const auto& item : functionBitMap)
-    {
-        std::cout << std::setfill('0') << std::setw(2) << std::hex << (int)item
-                  << " ";
-    }
-    std::cout << std::endl;
+    Logger::log(Logger::Subsystem::APP, Logger::INFO, "Bitmap received: {}",
+                Logger::Bytes{functionBitMap});
 
     types::FunctionalityList functionList;
 
@@ -50,9 +41,9 @@ void BusHandler::toggleFunctionState(types::FunctionalityList functionBitMap)
 
     if (functionList.empty())
     {
-        std::cout << "Empty function list received. Functions enabled before "
-                     "will be disabled."
-                  << std::endl;
+        Logger::log(Logger::Subsystem::APP, Logger::INFO,
+                    "Empty function list received. Functions enabled before "
+                    "will be disabled.");
     }
 
     // should be called even if the function list is empty, in case phyp wants
@@ -78,14 +69,16 @@ void BusHandler::btnRequest(int event)
             stateManager->processPanelButtonEvent(types::ButtonEvent::EXECUTE);
             break;
         default:
-            std::cerr << "Invalid Input" << std::endl;
+            Logger::log(Logger::Subsystem::APP, Logger::ERROR,
+                        "Invalid Input");
     }
 }
 
 types::ReturnStatus
-    BusHandler::triggerPanelFunc(const types::FunctionNumber funcNum)
+    BusHandler::triggerPanelFunc(const types::FunctionNumber funcNum,
+                                 boost::asio::yield_context yield)
 {
-    return (stateManager->triggerFunctionDirectly(funcNum));
+    return (stateManager->triggerFunctionDirectly(funcNum, yield));
 }
 
 types::Binary BusHandler::getEnabledFunctionsList()
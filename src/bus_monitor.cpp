@@ -1,14 +1,43 @@
 #include "bus_monitor.hpp"
 
+#include "bios_attributes.hpp"
+#include "callout.hpp"
 #include "const.hpp"
+#include "event_recorder.hpp"
+#include "logger.hpp"
+#include "progress_code.hpp"
+#include "progress_timeline.hpp"
+#include "src_record.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
-#include <boost/algorithm/string.hpp>
+#include <sdbusplus/asio/property.hpp>
 #include <vector>
 
 namespace panel
 {
+/* Subsystem the system event handlers log as. */
+static constexpr auto logSubsystem = Logger::Subsystem::EVENTS;
+
+/**
+ * @brief Read a string property of a PEL.
+ * @param[in] pelObjPath - Object path of the PEL.
+ * @param[in] property - Property name.
+ * @return Property value, std::nullopt if the read failed.
+ */
+static std::optional<std::string> readPelProperty(const std::string& pelObjPath,
+                                                  const std::string& property)
+{
+    const auto res = utils::readBusProperty<std::variant<std::string>>(
+        "xyz.openbmc_project.Logging", pelObjPath,
+        "xyz.openbmc_project.Logging.Entry", property);
+
+    if (const auto* value = std::get_if<std::string>(&res))
+    {
+        return *value;
+    }
+    return std::nullopt;
+}
 
 static void resetLEDState()
 {
@@ -42,17 +71,19 @@ static void resetLEDState()
                 }
                 catch (const sdbusplus::exception::SdBusError& e)
                 {
-                    std::cerr << "Write call for led " << led
-                              << " failed with exception " << e.what()
-                              << std::endl;
+                    Logger::log(logSubsystem, Logger::ERROR,
+                                "Write call for led {} failed with exception "
+                                "{}",
+                                led, e.what());
                 }
             }
         }
         else
         {
-            std::cerr
-                << "Failed to read asserted property. Unable to reset led "
-                << led << std::endl;
+            Logger::log(
+                logSubsystem, Logger::ERROR,
+                "Failed to read asserted property. Unable to reset led {}",
+                led);
         }
     }
 }
@@ -61,26 +92,15 @@ void PanelPresence::readBasePresentProperty(sdbusplus::message_t& msg)
 {
     if (msg.is_method_error())
     {
-        std::cerr << "\n Error in reading base panel presence signal "
-                  << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Error in reading base panel presence signal");
     }
-    std::string interface;
-    types::PropertyValueMap propMap;
-    msg.read(interface, propMap);
-    const auto itr = propMap.find("Present");
-    if (itr != propMap.end())
+
+    if (const auto present = signal::readChangedProperty<bool>(msg, "Present"))
     {
-        if (auto present = std::get_if<bool>(&(itr->second)))
+        if (*present)
         {
-            if (*present)
-            {
-                resetLEDState();
-            }
-        }
-        else
-        {
-            std::cerr << "\n Error reading base panel present property"
-                      << std::endl;
+            resetLEDState();
         }
     }
 }
@@ -89,44 +109,37 @@ void PanelPresence::readPresentProperty(sdbusplus::message_t& msg)
 {
     if (msg.is_method_error())
     {
-        std::cerr << "\n Error in reading panel presence signal " << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Error in reading panel presence signal");
     }
-    std::string object;
-    types::ItemInterfaceMap invItemMap;
-    msg.read(object, invItemMap);
-    const auto itr = invItemMap.find("Present");
-    if (itr != invItemMap.end())
+
+    const auto present = signal::readChangedProperty<bool>(msg, "Present");
+    if (!present)
     {
-        if (auto present = std::get_if<bool>(&(itr->second)))
-        {
-            transport->setTransportKey(*present);
-            if (transport->getPanelType() == types::PanelType::LCD && *present)
-            {
+        return;
+    }
 
-                const auto bmcState =
-                    utils::readBusProperty<std::variant<std::string>>(
-                        "xyz.openbmc_project.State.BMC",
-                        "/xyz/openbmc_project/state/bmc0",
-                        "xyz.openbmc_project.State.BMC", "CurrentBMCState");
+    record::recorder().record(record::EventType::PANEL_PRESENCE, *present);
+    transport->setTransportKey(*present);
+    if (transport->getPanelType() == types::PanelType::LCD && *present)
+    {
 
-                if (const auto* bmc = std::get_if<std::string>(&bmcState))
-                {
-                    if (*bmc == "xyz.openbmc_project.State.BMC.BMCState.Ready")
-                    {
-                        stateManager->updateBMCState(*bmc);
-                    }
-                }
-                else
-                {
-                    std::cerr
-                        << "Failed reading CurrentBMCState property from D-Bus."
-                        << std::endl;
-                }
+        const auto bmcState = utils::readBusProperty<std::variant<std::string>>(
+            "xyz.openbmc_project.State.BMC", "/xyz/openbmc_project/state/bmc0",
+            "xyz.openbmc_project.State.BMC", "CurrentBMCState");
+
+        if (const auto* bmc = std::get_if<std::string>(&bmcState))
+        {
+            if (*bmc == "xyz.openbmc_project.State.BMC.BMCState.Ready")
+            {
+                record::recorder().record(record::EventType::BMC_STATE, *bmc);
+                stateManager->updateBMCState(*bmc);
             }
         }
         else
         {
-            std::cerr << "\n Error reading panel present property" << std::endl;
+            Logger::log(logSubsystem, Logger::ERROR,
+                        "Failed reading CurrentBMCState property from D-Bus.");
         }
     }
 }
@@ -137,25 +150,19 @@ void PanelPresence::listenPanelPresence()
     // LEDs.
     if (objectPath == constants::everBaseDbusObj)
     {
-        static std::shared_ptr<sdbusplus::bus::match_t> everBasePanelPresence =
-            std::make_shared<sdbusplus::bus::match_t>(
-                *conn,
-                sdbusplus::bus::match::rules::propertiesChanged(
-                    objectPath, constants::itemInterface),
-                [this](sdbusplus::message_t& msg) {
-                    readBasePresentProperty(msg);
-                });
+        dispatcher->subscribe("BasePanelPresence",
+                              SignalDispatcher::SignalType::PROPERTIES_CHANGED,
+                              objectPath, constants::itemInterface,
+                              [this](sdbusplus::message_t& msg) {
+                                  readBasePresentProperty(msg);
+                              });
     }
     else
     {
-        static std::shared_ptr<sdbusplus::bus::match_t> matchPanelPresence =
-            std::make_shared<sdbusplus::bus::match_t>(
-                *conn,
-                sdbusplus::bus::match::rules::propertiesChanged(
-                    objectPath, constants::itemInterface),
-                [this](sdbusplus::message_t& msg) {
-                    readPresentProperty(msg);
-                });
+        dispatcher->subscribe(
+            "PanelPresence", SignalDispatcher::SignalType::PROPERTIES_CHANGED,
+            objectPath, constants::itemInterface,
+            [this](sdbusplus::message_t& msg) { readPresentProperty(msg); });
     }
 }
 
@@ -163,93 +170,101 @@ void PELListener::PELEventCallBack(sdbusplus::message_t& msg)
 {
     sdbusplus::message::object_path objPath;
 
-    types::DbusInterfaceMap infMap;
+    // Only the interface names are of interest, decode just the string
+    // properties and skip over the rest.
+    std::vector<std::pair<
+        std::string,
+        std::vector<std::pair<std::string, std::variant<std::string>>>>>
+        infMap;
     msg.read(objPath, infMap);
 
     // we need too handle signal only in case signal is populated for PEL.Entry
     // interface, as this confirms that data for Event ID field has been
     // populated and published.
-    if (infMap.find("org.open_power.Logging.PEL.Entry") != infMap.end())
+    if (std::find_if(infMap.begin(), infMap.end(), [](const auto& inf) {
+            return inf.first == "org.open_power.Logging.PEL.Entry";
+        }) == infMap.end())
+    {
+        return;
+    }
+
+    const auto severity = readPelProperty(objPath, "Severity");
+    if (!severity)
     {
-        auto res = utils::readBusProperty<std::variant<std::string>>(
-            "xyz.openbmc_project.Logging", objPath,
-            "xyz.openbmc_project.Logging.Entry", "Severity");
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Error fetching value of Severity. Ignoring the PEL");
+        return;
+    }
 
-        if (const auto& severity = std::get_if<std::string>(&res))
-        {
-            // Need to process PELs with severity non informational.
-            if (*severity !=
-                "xyz.openbmc_project.Logging.Entry.Level.Informational")
-            {
-                setPelRelatedFunctionState(objPath);
+    // Need to process PELs with severity non informational.
+    if (*severity == "xyz.openbmc_project.Logging.Entry.Level.Informational")
+    {
+        return;
+    }
 
-                res = utils::readBusProperty<std::variant<std::string>>(
-                    "xyz.openbmc_project.Logging", objPath,
-                    "xyz.openbmc_project.Logging.Entry", "EventId");
+    const auto resolution = readPelProperty(objPath, "Resolution");
+    const auto eventId = readPelProperty(objPath, "EventId");
 
-                if (const auto& eventId = std::get_if<std::string>(&res))
-                {
-                    // Terminating src detection.
-                    // Terminating bit is the bit 2(starting from 0)
-                    // from MSB end (Big Endian) of 5th Hex word.
-
-                    // Length for 5 hex words required is 44 including
-                    // spaces btween them.
-                    if ((*eventId).length() >=
-                        constants::fiveHexWordsWithSpaces)
-                    {
-                        std::vector<std::string> hexWords;
-                        boost::split(hexWords, *eventId, boost::is_any_of(" "));
-
-                        /*Steps used to check for terminating Bit.
-                        Eg: 5th Hexword = "A0000000".
-                        - Binary equivalent "1010 0000 0000 0000 0000
-                        0000 0000 0000"
-                        - Picking nibble from MSB - "1010"
-                        - Storing as a Byte - "0000 1010"
-                        - Bitwise AND with "0000 0010" to check the
-                        terminating bit.*/
-
-                        // picking a nibble value from MSB end (Big
-                        // Endian) of the hexword and storing as a char.
-                        char valueAtIndexZero[2] = {hexWords[4][0], '\0'};
-                        types::Byte byte =
-                            ::strtoul(valueAtIndexZero, nullptr, 16);
-
-                        if ((byte & constants::terminatingBits) != 0x00 &&
-                            (hexWords[0][0] == 'B' && hexWords[0][1] == 'D'))
-                        {
-                            // if terminating bit is set and response
-                            // code is for BMC i.e "BD". Send it
-                            // directly to display.
-                            utils::sendCurrDisplayToPanel(
-                                hexWords.at(0), std::string{}, transport);
-                        }
-                        executor->storeLastPelEventId(*eventId);
-                        lastPelObjPath = objPath;
-                        return;
-                    }
-                    std::cerr << "Event Id length is invalid" << std::endl;
-                    return;
-                }
-                else
-                {
-                    std::cerr
-                        << "Error fetching value of EventID. Ignoring the PEL."
-                        << std::endl;
-                }
-            }
-        }
-        else
-        {
-            std::cerr << "Error fetching value of Severity. Ignoring the PEL"
-                      << std::endl;
-        }
+    record::recorder().record(
+        record::EventType::PEL_ADDED, objPath.str, resolution.has_value(),
+        resolution.value_or(std::string{}), eventId.has_value(),
+        eventId.value_or(std::string{}));
+
+    processPelAdded(objPath, resolution, eventId);
+}
+
+void PELListener::processPelAdded(const std::string& pelObjPath,
+                                  const std::optional<std::string>& resolution,
+                                  const std::optional<std::string>& eventId)
+{
+    setPelRelatedFunctionState(pelObjPath, resolution);
+
+    if (!eventId)
+    {
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Error fetching value of EventID. Ignoring the PEL.");
+        return;
+    }
+
+    // Terminating src detection.
+    // Terminating bit is the bit 2(starting from 0)
+    // from MSB end (Big Endian) of 5th Hex word.
+
+    // Length for 5 hex words required is 44 including
+    // spaces btween them.
+    if ((*eventId).length() < constants::fiveHexWordsWithSpaces)
+    {
+        Logger::log(logSubsystem, Logger::ERROR, "Event Id length is invalid");
+        return;
+    }
+
+    const auto srcRecord = SrcRecord::fromEventId(*eventId);
+
+    /*Steps used to check for terminating Bit.
+    Eg: 5th Hexword = 0xA0000000.
+    - Picking nibble from MSB - "1010"
+    - Bitwise AND with "1010" to check the
+    terminating bit.*/
+    // 5th hexword is the 4th after the SRC.
+    const types::Byte nibble =
+        (srcRecord.hexWordCount >= 4) ? (srcRecord.hexWords[3] >> 28) : 0;
+    if ((nibble & constants::terminatingBits) != 0x00 &&
+        srcRecord.getSrc().starts_with("BD"))
+    {
+        // if terminating bit is set and response
+        // code is for BMC i.e "BD". Send it
+        // directly to display.
+        progressCode.cancelPending();
+        executor->getRenderer().show(display::Layer::PROGRESS,
+                                     srcRecord.getSrc(), std::string_view{});
     }
+    executor->storeSRCAndHexwords(srcRecord);
+    lastPelObjPath = pelObjPath;
+    pelSignalled = true;
 }
 
 void PELListener::setPelRelatedFunctionState(
-    const sdbusplus::message::object_path& pelObjPath)
+    const std::string& pelObjPath, const std::optional<std::string>& resolution)
 {
     types::FunctionalityList list;
     // as there are maximum 9 SRC related functions.
@@ -265,21 +280,14 @@ void PELListener::setPelRelatedFunctionState(
         list.emplace_back(13);
     }
 
-    const auto res = utils::readBusProperty<std::variant<std::string>>(
-        "xyz.openbmc_project.Logging", pelObjPath,
-        "xyz.openbmc_project.Logging.Entry", "Resolution");
-
-    if (const auto& resolution = std::get_if<std::string>(&res))
+    if (resolution)
     {
         if (!(*resolution).empty())
         {
-            std::vector<std::string> callOutList;
-            boost::split(callOutList, *resolution, boost::is_any_of("\n"));
-
-            // Need to show max 6 callout src.
-            auto size = std::min(callOutList.size(), static_cast<size_t>(6));
-            // if resolution is not there size should not be set to negative.
-            size = (size == 0) ? static_cast<size_t>(0) : (size - 1);
+            // Callouts are rendered once here, functions 14 to 19 display
+            // them as is.
+            auto callOutList = CallOut::parseResolution(*resolution);
+            const auto size = callOutList.size();
 
             // default list: 14 to 19 are the functions to display
             // callout SRCs.
@@ -303,18 +311,19 @@ void PELListener::setPelRelatedFunctionState(
                 stateManager->disableFunctonality(disableFunc);
             }
 
-            executor->pelCallOutList(callOutList);
+            executor->pelCallOutList(std::move(callOutList));
         }
         else
         {
-            std::cout << "Resolution is empty for PEL = "
-                      << (std::string)pelObjPath << std::endl;
+            Logger::log(logSubsystem, Logger::INFO,
+                        "Resolution is empty for PEL = {}", pelObjPath);
         }
     }
     else
     {
-        std::cerr << "Error fetching value of resolution for PEL = "
-                  << (std::string)pelObjPath << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Error fetching value of resolution for PEL = {}",
+                    pelObjPath);
     }
 
     if (list.size() > 0)
@@ -323,39 +332,65 @@ void PELListener::setPelRelatedFunctionState(
     }
 }
 
-void PELListener::getListOfExistingPels()
+void PELListener::getListOfExistingPels(LoadedCallback onLoaded)
 {
-    auto listOfSortedPels = utils::geListOfPELsAndSRCs();
+    conn->async_method_call(
+        [this, onLoaded](const boost::system::error_code& ec,
+                         types::GetManagedObjects& listOfPels) {
+            if (ec)
+            {
+                Logger::log(logSubsystem, Logger::ERROR,
+                            "Failed to read existing PELs. {}", ec.message());
+            }
+            else if (!pelSignalled)
+            {
+                auto listOfSortedPels =
+                    utils::geListOfPELsAndSRCs(std::move(listOfPels));
 
-    // Implies there are PELs logged in the system with desired severity
-    // before panel came up.
-    if (!listOfSortedPels.empty())
-    {
-        // store the last pel details. Required to compare and disable functions
-        // 11 to 19 in case this PEL gets deleted.
-        lastPelObjPath = std::get<0>(listOfSortedPels[0]);
-        executor->storeLastPelEventId(std::get<1>(listOfSortedPels[0]));
+                // Implies there are PELs logged in the system with desired
+                // severity before panel came up.
+                if (!listOfSortedPels.empty())
+                {
+                    // store the last pel details. Required to compare and
+                    // disable functions 11 to 19 in case this PEL gets deleted.
+                    lastPelObjPath = std::get<0>(listOfSortedPels[0]);
+                    executor->storeSRCAndHexwords(SrcRecord::fromEventId(
+                        std::get<1>(listOfSortedPels[0])));
+
+                    // enable or disable functions based on latest PEL logged.
+                    const auto resolution =
+                        readPelProperty(lastPelObjPath, "Resolution");
+                    record::recorder().record(
+                        record::EventType::PEL_ADDED, lastPelObjPath,
+                        resolution.has_value(),
+                        resolution.value_or(std::string{}), true,
+                        std::get<1>(listOfSortedPels[0]));
+                    setPelRelatedFunctionState(lastPelObjPath, resolution);
+                }
+            }
 
-        // enable or disable functions based on latest PEL logged.
-        setPelRelatedFunctionState(lastPelObjPath);
-    }
+            if (onLoaded)
+            {
+                onLoaded();
+            }
+        },
+        "xyz.openbmc_project.Logging", "/xyz/openbmc_project/logging",
+        "org.freedesktop.DBus.ObjectManager", "GetManagedObjects");
 }
 
-void PELListener::listenPelEvents()
+void PELListener::listenPelEvents(LoadedCallback onLoaded)
 {
-    static auto sigMatch = std::make_unique<sdbusplus::bus::match_t>(
-        *conn,
-        sdbusplus::bus::match::rules::interfacesAdded(
-            "/xyz/openbmc_project/logging"),
+    dispatcher->subscribe(
+        "PELAdded", SignalDispatcher::SignalType::INTERFACES_ADDED,
+        "/xyz/openbmc_project/logging", std::string{},
         [this](sdbusplus::message_t& msg) { PELEventCallBack(msg); });
 
-    static auto infRemovedSigMatch = std::make_unique<sdbusplus::bus::match_t>(
-        *conn,
-        sdbusplus::bus::match::rules::interfacesRemoved(
-            "/xyz/openbmc_project/logging"),
+    dispatcher->subscribe(
+        "PELRemoved", SignalDispatcher::SignalType::INTERFACES_REMOVED,
+        "/xyz/openbmc_project/logging", std::string{},
         [this](sdbusplus::message_t& msg) { PELDeleteEventCallBack(msg); });
 
-    getListOfExistingPels();
+    getListOfExistingPels(std::move(onLoaded));
 }
 
 void PELListener::PELDeleteEventCallBack(sdbusplus::message_t& msg)
@@ -364,301 +399,252 @@ void PELListener::PELDeleteEventCallBack(sdbusplus::message_t& msg)
     std::vector<std::string> interface;
     msg.read(objPath, interface);
 
-    for (const auto& element : interface)
+    if (std::find(interface.begin(), interface.end(),
+                  "xyz.openbmc_project.Object.Delete") == interface.end())
     {
-        if (element == "xyz.openbmc_project.Object.Delete")
-        {
-            if (objPath == lastPelObjPath)
-            {
-                // We need to disable function 11 to 19 as the last PEL of
-                // required severity has been deleted.
-                stateManager->disableFunctonality(
-                    {11, 12, 13, 14, 15, 16, 17, 18, 19});
-                lastPelObjPath.clear();
-
-                // as functions are disabled, set the flag to false
-                functionStateEnabled = false;
-
-                // reset LCD panel to display function 01 as there can be a
-                // situation where user is already on one of the function
-                // between 11-19 before deleting the PEL. After disabling these
-                // function user should not have access to them.
-                auto curState =
-                    std::get<0>(stateManager->getPanelCurrentStateInfo());
-                if (curState >= 11 && curState <= 19)
-                {
-                    stateManager->resetStateManager();
-                }
-            }
-        }
+        return;
+    }
+
+    record::recorder().record(record::EventType::PEL_REMOVED, objPath.str);
+    processPelRemoved(objPath);
+}
+
+void PELListener::processPelRemoved(const std::string& pelObjPath)
+{
+    if (pelObjPath != lastPelObjPath)
+    {
+        return;
+    }
+
+    // We need to disable function 11 to 19 as the last PEL of
+    // required severity has been deleted.
+    stateManager->disableFunctonality({11, 12, 13, 14, 15, 16, 17, 18, 19});
+    lastPelObjPath.clear();
+
+    // as functions are disabled, set the flag to false
+    functionStateEnabled = false;
+
+    // reset LCD panel to display function 01 as there can be a
+    // situation where user is already on one of the function
+    // between 11-19 before deleting the PEL. After disabling these
+    // function user should not have access to them.
+    auto curState = std::get<0>(stateManager->getPanelCurrentStateInfo());
+    if (curState >= 11 && curState <= 19)
+    {
+        stateManager->resetStateManager();
     }
 }
 
 void BootProgressCode::listenProgressCode()
 {
-    // signal match for sdbusplus
-    static auto sigMatch = std::make_unique<sdbusplus::bus::match_t>(
-        *conn,
-        sdbusplus::bus::match::rules::propertiesChanged(
-            "/xyz/openbmc_project/state/boot/raw0",
-            "xyz.openbmc_project.State.Boot.Raw"),
+    dispatcher->subscribe(
+        "ProgressCode", SignalDispatcher::SignalType::PROPERTIES_CHANGED,
+        "/xyz/openbmc_project/state/boot/raw0",
+        "xyz.openbmc_project.State.Boot.Raw",
         [this](sdbusplus::message_t& msg) { progressCodeCallBack(msg); });
 }
 
 void BootProgressCode::progressCodeCallBack(sdbusplus::message_t& msg)
 {
-    using PostCode = std::tuple<uint64_t, std::vector<types::Byte>>;
+    // property we are looking for.
+    const auto postCodeData =
+        signal::readChangedProperty<PostCode>(msg, "Value");
+    if (!postCodeData)
+    {
+        return;
+    }
 
-    std::string interface;
-    std::map<std::string, std::variant<PostCode>> propertyMap;
+    record::recorder().record(record::EventType::PROGRESS_CODE,
+                              std::get<0>(*postCodeData),
+                              std::get<1>(*postCodeData));
+    processProgressCode(*postCodeData);
+}
 
-    msg.read(interface, propertyMap);
+void BootProgressCode::processProgressCode(const PostCode& postCode)
+{
+    auto src = std::get<0>(postCode);
 
-    // property we are looking for.
-    const auto it = propertyMap.find("Value");
-    if (it != propertyMap.end())
+    // clear display if progress code ascii equals to
+    // "00000000"
+    if (src == constants::clearDisplayProgressCode)
     {
-        if (auto postCodeData = std::get_if<PostCode>(&(it->second)))
+        // Boot is done, a progress code held back is stale.
+        cancelPending();
+        if (!isBootComplete)
         {
-            auto src = std::get<0>(*postCodeData);
+            Logger::log(logSubsystem, Logger::INFO,
+                        "Progress codes of the boot received = {}, displayed "
+                        "= {}",
+                        receivedCount, displayedCount);
+            isBootComplete = true;
+        }
 
-            // clear display if progress code ascii equals to
-            // "00000000"
-            if (src == constants::clearDisplayProgressCode)
-            {
-                utils::sendCurrDisplayToPanel(std::string{}, std::string{},
-                                              transport);
-                // default the display by executing function 01.
-                executor->executeFunction(1, types::FunctionalityList{});
-                return;
-            }
+        executor->getRenderer().show(display::Layer::PROGRESS, std::string{},
+                                     std::string{});
+        // default the display by executing function 01.
+        executor->executeFunction(1, types::FunctionalityList{});
+        return;
+    }
 
-            std::vector<types::Byte> byteArray;
-            byteArray.reserve(sizeof(src));
+    if (isBootComplete)
+    {
+        receivedCount = 0;
+        displayedCount = 0;
+        isBootComplete = false;
+        timeline::store().startBoot();
+    }
+    receivedCount++;
 
-            for (size_t i = 0; i < sizeof(src); i++)
-            {
-                byteArray.emplace_back(types::Byte(src >> (sizeof(src) * i)) &
-                                       0xFF);
-            }
+    auto srcRecord = progress_code::decodeSrc(src);
+    displayProgressCode(srcRecord);
 
-            utils::sendCurrDisplayToPanel(
-                std::string(byteArray.begin(), byteArray.end()), std::string{},
-                transport);
+    // Read the hexwords sent down by Phyp. If the hexwords are present
+    // we need to store the SRC to show in function 11 and Hexwords to
+    // show in function 12 and 13.
+    const std::vector<types::Byte>& hexWordArray = std::get<1>(postCode);
 
-            executor->storeIPLSRC(
-                std::string(byteArray.begin(), byteArray.end()));
+    // Its a fixed size array of length 72.
+    const bool isHexWordArrayValid =
+        hexWordArray.size() >= progress_code::hexWordDataLength;
+    if (!isHexWordArrayValid)
+    {
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Error reading postcode byte array");
+    }
 
-            // Read the hexwords sent down by Phyp. If the hexwords are present
-            // we need to store the SRC to show in function 11 and Hexwords to
-            // show in function 12 and 13.
-            std::vector<types::Byte> hexWordArray = std::get<1>(*postCodeData);
+    // To detect if there is a need to save SRCs and hexwords in func 11
+    // to 13, check for array data filled with space.
+    const bool hasHexWords =
+        isHexWordArrayValid && progress_code::hasHexWords(hexWordArray);
+    if (hasHexWords)
+    {
+        progress_code::decodeHexWords(hexWordArray, srcRecord);
+    }
 
-            // Its a fixed size array of length 72.
-            if (hexWordArray.empty() || hexWordArray.size() < 72)
-            {
-                std::cerr << "Error reading postcode byte array" << std::endl;
-                return;
-            }
+    // History keeps every code, displayed or not, with its hexwords.
+    executor->storeIPLSRC(srcRecord);
 
-            // To detect if there is a need to save SRCs and hexwords in func 11
-            // to 13, check for array data filled with space.
-            if (hexWordArray.at(0) != 0x20)
-            {
-                // store the SRC.
-                std::string hexWordsWithSRC =
-                    std::string(byteArray.begin(), byteArray.end());
-
-                // 4th byte will return number of valid hex words.
-                types::Byte validHexWords = hexWordArray.at(3);
-
-                // Ignoring the first 8 bytes from the array as those are some
-                // header related data not HEX words. Hex words are represented
-                // as 4 bytes so read 4*validHexWords bytes to read all the
-                // hexwords.
-                std::ostringstream convert;
-                for (size_t arrayLoop = 8; arrayLoop <= (4 * validHexWords);)
-                {
-                    // clear any previous data.
-                    convert.str("");
+    if (hasHexWords)
+    {
+        executor->storeSRCAndHexwords(srcRecord);
+    }
+}
 
-                    hexWordsWithSRC += " ";
+void BootProgressCode::displayProgressCode(const SrcRecord& srcRecord)
+{
+    const auto dwellEnd = shownAt + constants::progressCodeDwell;
+    if (std::chrono::steady_clock::now() >= dwellEnd)
+    {
+        showProgressCode(srcRecord);
+        return;
+    }
 
-                    // From this offet read 4 bytes, convert them to HEX and
-                    // then append to final string of hexwords and SRC.
-                    for (size_t hexWordLoop = 0; hexWordLoop < 4; ++hexWordLoop)
-                    {
-                        convert
-                            << std::setfill('0') << std::setw(2) << std::hex
-                            << static_cast<int>(hexWordArray.at(arrayLoop++));
+    const bool isTimerArmed = pendingCode.has_value();
+    pendingCode = srcRecord;
+    if (isTimerArmed)
+    {
+        return;
+    }
 
-                        hexWordsWithSRC += convert.str();
-                    }
-                }
-                executor->storeSRCAndHexwords(hexWordsWithSRC);
-            }
-        }
-        else
+    dwellTimer.expires_at(dwellEnd);
+    dwellTimer.async_wait([this](const boost::system::error_code& ec) {
+        if (ec == boost::asio::error::operation_aborted || !pendingCode)
         {
-            std::cerr << "Progress code Data error" << std::endl;
+            return;
         }
-    }
+        showProgressCode(*pendingCode);
+        pendingCode.reset();
+    });
+}
+
+void BootProgressCode::cancelPending()
+{
+    dwellTimer.cancel();
+    pendingCode.reset();
+}
+
+void BootProgressCode::showProgressCode(const SrcRecord& srcRecord)
+{
+    executor->getRenderer().show(display::Layer::PROGRESS,
+                                 srcRecord.getSrc(), std::string_view{});
+    shownAt = std::chrono::steady_clock::now();
+    displayedCount++;
 }
 
 SystemStatus::SystemStatus(
     std::shared_ptr<sdbusplus::asio::connection>& con,
-    std::shared_ptr<state::manager::PanelStateManager>& manager) :
+    std::shared_ptr<SignalDispatcher>& dispatcher,
+    std::shared_ptr<state::manager::PanelStateManager>& manager,
+    LoadedCallback onLoaded) :
     conn(con),
-    stateManager(manager)
+    dispatcher(dispatcher), stateManager(manager), onLoaded(std::move(onLoaded))
 {
-    initSystemOperatingMode();
+    // Register signals before reading, so that no change is lost in between.
     listenBmcState();
     listenBootProgressState();
     listenPowerState();
     listenSystemOperatingMode();
+
+    loadInitialState();
 }
 
 void SystemStatus::bmcStateCallback(sdbusplus::message_t& msg)
 {
-    std::string object{};
-    types::ItemInterfaceMap invItemMap;
-
-    msg.read(object, invItemMap);
-    const auto itr = invItemMap.find("CurrentBMCState");
-    if (itr != invItemMap.end())
+    if (const auto bmcState =
+            signal::readChangedProperty<std::string>(msg, "CurrentBMCState"))
     {
-        if (auto bmcState = std::get_if<std::string>(&(itr->second)))
-        {
-            // std::cout << "BMC state = " << *bmcState << std::endl;
-            stateManager->updateBMCState(*bmcState);
-        }
-        else
-        {
-            std::cerr << "\n Error reading bmc state property" << std::endl;
-        }
+        signalled |= InitialState::BMC_STATE;
+        record::recorder().record(record::EventType::BMC_STATE, *bmcState);
+        stateManager->updateBMCState(*bmcState);
     }
 }
 
 void SystemStatus::listenBmcState()
 {
-    // Before registering signal read the current value
-    auto retCurBmcState = utils::readBusProperty<std::variant<std::string>>(
-        "xyz.openbmc_project.State.BMC", "/xyz/openbmc_project/state/bmc0",
-        "xyz.openbmc_project.State.BMC", "CurrentBMCState");
-
-    if (auto curBmcState = std::get_if<std::string>(&retCurBmcState))
-    {
-        stateManager->updateBMCState(*curBmcState);
-    }
-    else
-    {
-        // read failed for current bmc state so set it as "not ready".
-        stateManager->updateBMCState(
-            "xyz.openbmc_project.State.BMC.BMCState.NotReady");
-    }
-
-    static auto sigBmcState = std::make_unique<sdbusplus::bus::match_t>(
-        *conn,
-        sdbusplus::bus::match::rules::propertiesChanged(
-            "/xyz/openbmc_project/state/bmc0", "xyz.openbmc_project.State.BMC"),
+    dispatcher->subscribe(
+        "BMCState", SignalDispatcher::SignalType::PROPERTIES_CHANGED,
+        "/xyz/openbmc_project/state/bmc0", "xyz.openbmc_project.State.BMC",
         [this](sdbusplus::message_t& msg) { bmcStateCallback(msg); });
 }
 
 void SystemStatus::powerStateCallback(sdbusplus::message_t& msg)
 {
-    std::string object{};
-    types::ItemInterfaceMap invItemMap;
-
-    msg.read(object, invItemMap);
-    const auto itr = invItemMap.find("CurrentPowerState");
-    if (itr != invItemMap.end())
+    if (const auto powerState =
+            signal::readChangedProperty<std::string>(msg, "CurrentPowerState"))
     {
-        if (auto powerState = std::get_if<std::string>(&(itr->second)))
-        {
-            // std::cout << "Power state = " << *powerState << std::endl;
-            stateManager->updatePowerState(*powerState);
-        }
-        else
-        {
-            std::cerr << "\n Error reading power state property" << std::endl;
-        }
+        signalled |= InitialState::POWER_STATE;
+        record::recorder().record(record::EventType::POWER_STATE, *powerState);
+        stateManager->updatePowerState(*powerState);
     }
 }
 
 void SystemStatus::listenPowerState()
 {
-    // Before registering signal read the current value
-    auto retCurPowerState = utils::readBusProperty<std::variant<std::string>>(
-        "xyz.openbmc_project.State.Chassis",
+    dispatcher->subscribe(
+        "PowerState", SignalDispatcher::SignalType::PROPERTIES_CHANGED,
         "/xyz/openbmc_project/state/chassis0",
-        "xyz.openbmc_project.State.Chassis", "CurrentPowerState");
-
-    if (auto curPowerState = std::get_if<std::string>(&retCurPowerState))
-    {
-        stateManager->updatePowerState(*curPowerState);
-    }
-    else
-    {
-        // read failed for power state so set it as "Off".
-        stateManager->updatePowerState(
-            "xyz.openbmc_project.State.Chassis.PowerState.Off");
-    }
-
-    static auto sigPowerState = std::make_unique<sdbusplus::bus::match_t>(
-        *conn,
-        sdbusplus::bus::match::rules::propertiesChanged(
-            "/xyz/openbmc_project/state/chassis0",
-            "xyz.openbmc_project.State.Chassis"),
+        "xyz.openbmc_project.State.Chassis",
         [this](sdbusplus::message_t& msg) { powerStateCallback(msg); });
 }
 
 void SystemStatus::bootProgressStateCallback(sdbusplus::message_t& msg)
 {
-    std::string object{};
-    types::ItemInterfaceMap invItemMap;
-
-    msg.read(object, invItemMap);
-    const auto itr = invItemMap.find("BootProgress");
-    if (itr != invItemMap.end())
+    if (const auto bootProgressState =
+            signal::readChangedProperty<std::string>(msg, "BootProgress"))
     {
-        if (auto bootProgressState = std::get_if<std::string>(&(itr->second)))
-        {
-            // std::cout << "boot progress state = " << *bootProgressState
-            //          << std::endl;
-            stateManager->updateBootProgressState(*bootProgressState);
-        }
-        else
-        {
-            std::cerr << "\n Error reading boot progress state property"
-                      << std::endl;
-        }
+        signalled |= InitialState::BOOT_PROGRESS_STATE;
+        record::recorder().record(record::EventType::BOOT_PROGRESS,
+                                  *bootProgressState);
+        stateManager->updateBootProgressState(*bootProgressState);
     }
 }
 
 void SystemStatus::listenBootProgressState()
 {
-    // Before registering signal read the current value
-    auto retBootProgress = utils::readBusProperty<std::variant<std::string>>(
-        "xyz.openbmc_project.State.Host", "/xyz/openbmc_project/state/host0",
-        "xyz.openbmc_project.State.Boot.Progress", "BootProgress");
-
-    if (auto curBootProgressState = std::get_if<std::string>(&retBootProgress))
-    {
-        stateManager->updateBootProgressState(*curBootProgressState);
-    }
-    else
-    {
-        // read failed for boot progress state so set it as "Unspecified".
-        stateManager->updateBootProgressState(
-            "xyz.openbmc_project.State.Boot.Progress."
-            "ProgressStages.Unspecified");
-    }
-
-    static auto sigBootState = std::make_unique<sdbusplus::bus::match_t>(
-        *conn,
-        sdbusplus::bus::match::rules::propertiesChanged(
-            "/xyz/openbmc_project/state/host0",
-            "xyz.openbmc_project.State.Boot.Progress"),
+    dispatcher->subscribe(
+        "BootProgress", SignalDispatcher::SignalType::PROPERTIES_CHANGED,
+        "/xyz/openbmc_project/state/host0",
+        "xyz.openbmc_project.State.Boot.Progress",
         [this](sdbusplus::message_t& msg) { bootProgressStateCallback(msg); });
 }
 
@@ -666,63 +652,160 @@ void SystemStatus::biosAttributesCallback(sdbusplus::message_t& msg)
 {
     if (msg.is_method_error())
     {
-        std::cerr << "Error in reading BIOS attribute signal " << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Error in reading BIOS attribute signal");
         return;
     }
 
-    std::string object;
-    types::BiosBaseTableType propMap;
-    msg.read(object, propMap);
-    for (auto property : propMap)
+    const auto baseBiosTable =
+        signal::readChangedProperty<types::BiosBaseTable>(msg, "BaseBIOSTable");
+    if (!baseBiosTable)
     {
-        if (property.first == "BaseBIOSTable")
+        // Some other property of the BIOS config manager changed.
+        return;
+    }
+
+    signalled |= InitialState::OPERATING_MODE;
+
+    auto& biosAttributes = bios::attributes();
+    const auto changed = biosAttributes.update(*baseBiosTable);
+
+    if (changed & bios::maskOf(bios::Attribute::SYSTEM_OPERATING_MODE))
+    {
+        const auto& operatingMode =
+            biosAttributes.get(bios::Attribute::SYSTEM_OPERATING_MODE);
+        if (!operatingMode.empty())
         {
-            auto biosBaseTable = std::get<0>(property.second);
-            for (const auto& biosItem : biosBaseTable)
-            {
-                auto attributeName = std::get<0>(biosItem);
-                if (attributeName == "pvm_system_operating_mode")
-                {
-                    auto attrValue = std::get<5>(std::get<1>(biosItem));
-                    if (auto val = std::get_if<std::string>(&attrValue))
-                    {
-                        stateManager->setSystemOperatingMode(*val);
-                    }
-                    else
-                    {
-                        std::cerr << "Error reading bios attribute for system "
-                                     "operating mode"
-                                  << std::endl;
-                    }
-                }
-            }
+            record::recorder().record(record::EventType::OPERATING_MODE,
+                                      operatingMode);
+            stateManager->setSystemOperatingMode(operatingMode);
+        }
+        else
+        {
+            Logger::log(logSubsystem, Logger::ERROR,
+                        "Error reading bios attribute for system operating "
+                        "mode");
         }
     }
 }
 
 void SystemStatus::listenSystemOperatingMode()
 {
-    static auto biosMatcher = std::make_unique<sdbusplus::bus::match_t>(
-        *conn,
-        sdbusplus::bus::match::rules::propertiesChanged(
-            "/xyz/openbmc_project/bios_config/manager",
-            "xyz.openbmc_project.BIOSConfig.Manager"),
+    dispatcher->subscribe(
+        "BIOSAttributes", SignalDispatcher::SignalType::PROPERTIES_CHANGED,
+        "/xyz/openbmc_project/bios_config/manager",
+        "xyz.openbmc_project.BIOSConfig.Manager",
         [this](sdbusplus::message_t& msg) { biosAttributesCallback(msg); });
 }
 
-void SystemStatus::initSystemOperatingMode()
+void SystemStatus::loadInitialState()
 {
-    auto systemOperatingMode = std::get<1>(utils::readSystemParameters());
+    pendingReads = 4;
+
+    sdbusplus::asio::getProperty<std::string>(
+        *conn, "xyz.openbmc_project.State.BMC",
+        "/xyz/openbmc_project/state/bmc0", "xyz.openbmc_project.State.BMC",
+        "CurrentBMCState",
+        [this](const boost::system::error_code& ec,
+               const std::string& bmcState) {
+            if (!(signalled & InitialState::BMC_STATE))
+            {
+                // read failed for current bmc state so set it as "not ready".
+                const std::string state =
+                    ec ? "xyz.openbmc_project.State.BMC.BMCState.NotReady"
+                       : bmcState;
+                record::recorder().record(record::EventType::BMC_STATE, state);
+                stateManager->updateBMCState(state);
+            }
+            initialReadDone();
+        });
+
+    sdbusplus::asio::getProperty<std::string>(
+        *conn, "xyz.openbmc_project.State.Chassis",
+        "/xyz/openbmc_project/state/chassis0",
+        "xyz.openbmc_project.State.Chassis", "CurrentPowerState",
+        [this](const boost::system::error_code& ec,
+               const std::string& powerState) {
+            if (!(signalled & InitialState::POWER_STATE))
+            {
+                // read failed for power state so set it as "Off".
+                const std::string state =
+                    ec ? "xyz.openbmc_project.State.Chassis.PowerState.Off"
+                       : powerState;
+                record::recorder().record(record::EventType::POWER_STATE,
+                                          state);
+                stateManager->updatePowerState(state);
+            }
+            initialReadDone();
+        });
+
+    sdbusplus::asio::getProperty<std::string>(
+        *conn, "xyz.openbmc_project.State.Host",
+        "/xyz/openbmc_project/state/host0",
+        "xyz.openbmc_project.State.Boot.Progress", "BootProgress",
+        [this](const boost::system::error_code& ec,
+               const std::string& bootProgressState) {
+            if (!(signalled & InitialState::BOOT_PROGRESS_STATE))
+            {
+                // read failed for boot progress state so set it as
+                // "Unspecified".
+                const std::string state =
+                    ec ? "xyz.openbmc_project.State.Boot.Progress."
+                         "ProgressStages.Unspecified"
+                       : bootProgressState;
+                record::recorder().record(record::EventType::BOOT_PROGRESS,
+                                          state);
+                stateManager->updateBootProgressState(state);
+            }
+            initialReadDone();
+        });
+
+    sdbusplus::asio::getProperty<types::BiosBaseTable>(
+        *conn, "xyz.openbmc_project.BIOSConfigManager",
+        "/xyz/openbmc_project/bios_config/manager",
+        "xyz.openbmc_project.BIOSConfig.Manager", "BaseBIOSTable",
+        [this](const boost::system::error_code& ec,
+               const types::BiosBaseTable& baseBiosTable) {
+            if (!(signalled & InitialState::OPERATING_MODE))
+            {
+                std::string systemOperatingMode{};
+
+                // An empty table means BIOS config manager is not populated
+                // yet.
+                if (!ec && !baseBiosTable.empty())
+                {
+                    auto& biosAttributes = bios::attributes();
+                    biosAttributes.update(baseBiosTable);
+                    systemOperatingMode = biosAttributes.get(
+                        bios::Attribute::SYSTEM_OPERATING_MODE);
+                }
+
+                if (systemOperatingMode.empty())
+                {
+                    Logger::log(logSubsystem, Logger::ERROR,
+                                "System operating mode read as empty from "
+                                "Bios attributes, set as default- Normal");
+                    systemOperatingMode = "Normal";
+                }
 
-    if (systemOperatingMode.empty())
+                record::recorder().record(record::EventType::OPERATING_MODE,
+                                          systemOperatingMode);
+                stateManager->setSystemOperatingMode(systemOperatingMode);
+            }
+            initialReadDone();
+        });
+}
+
+void SystemStatus::initialReadDone()
+{
+    if (pendingReads == 0 || --pendingReads != 0)
     {
-        std::cerr << "System operating mode read as empty from Bios "
-                     "attributes, set as default- Normal"
-                  << std::endl;
-        stateManager->setSystemOperatingMode("Normal");
         return;
     }
 
-    stateManager->setSystemOperatingMode(systemOperatingMode);
+    if (onLoaded)
+    {
+        onLoaded();
+    }
 }
 } // namespace panel
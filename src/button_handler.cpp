@@ -1,13 +1,13 @@
 #include "button_handler.hpp"
 
 #include "const.hpp"
+#include "event_recorder.hpp"
 #include "panel_state_manager.hpp"
 #include "utils.hpp"
 
 #include <assert.h>
 
 #include <boost/asio.hpp>
-#include <ranges>
 
 namespace panel
 {
@@ -18,7 +18,8 @@ ButtonHandler::ButtonHandler(
     std::shared_ptr<state::manager::PanelStateManager> stateManager,
     const std::string& busPath) :
     devicePath(path),
-    io(io), transport(transport), stateManager(stateManager), busPath(busPath)
+    io(io), transport(transport), stateManager(stateManager), busPath(busPath),
+    debounceTimer(*io)
 {
     // TODO update this to actual size needed.
     ipEvent.resize(10);
@@ -79,36 +80,89 @@ void ButtonHandler::processInputEvent(const boost::system::error_code& ec,
     if (!ec)
     {
         auto const numOfEvents = bytesTransferred / sizeof(input_event);
+        processButtonEvents(std::span(ipEvent.data(), numOfEvents));
+    }
+}
+
+void ButtonHandler::processButtonEvents(std::span<const input_event> events)
+{
+    if (auto& recorder = record::recorder(); recorder.isActive())
+    {
+        record::Payload payload;
+        payload << static_cast<uint16_t>(events.size());
+        for (const auto& ev : events)
+        {
+            payload << ev.code << ev.value;
+        }
+        recorder.record(record::EventType::BUTTON, payload);
+    }
+
+    for (const auto& ev : events)
+    {
+        // process only for press event i.e. 1, skip the release events.
+        if (ev.value == 0)
+        {
+            continue;
+        }
+        switch (ev.code)
+        {
+            case BTN_NORTH:
+                pendingOffset++;
+                break;
+
+            case BTN_SOUTH:
+                pendingOffset--;
+                break;
+
+            case BTN_SELECT:
+                // Navigation pressed before execute applies first.
+                applyPendingNavigation();
+                stateManager->processPanelButtonEvent(
+                    types::ButtonEvent::EXECUTE);
+                break;
+
+            default: /* unknown button event*/
+                break;
+        }
+    }
+
+    if (pendingOffset == 0 || isDebounceTimerArmed)
+    {
+        return;
+    }
+
+    if (constants::buttonDebounceInterval.count() == 0)
+    {
+        applyPendingNavigation();
+        return;
+    }
 
-        for (auto& ev : std::views::counted(ipEvent.begin(), numOfEvents))
+    // Presses received till the timer expires are applied together.
+    isDebounceTimerArmed = true;
+    debounceTimer.expires_after(constants::buttonDebounceInterval);
+    debounceTimer.async_wait([this](const boost::system::error_code& ec) {
+        if (ec == boost::asio::error::operation_aborted)
         {
-            // process only for release event i.e. 1
-            if (ev.value == 0)
-            {
-                return;
-            }
-            switch (ev.code)
-            {
-                case BTN_NORTH:
-                    stateManager->processPanelButtonEvent(
-                        types::ButtonEvent::INCREMENT);
-                    break;
-
-                case BTN_SOUTH:
-                    stateManager->processPanelButtonEvent(
-                        types::ButtonEvent::DECREMENT);
-                    break;
-
-                case BTN_SELECT:
-                    stateManager->processPanelButtonEvent(
-                        types::ButtonEvent::EXECUTE);
-                    break;
-
-                default: /* unknown button event*/
-                    break;
-            }
+            return;
         }
+        applyPendingNavigation();
+    });
+}
+
+void ButtonHandler::applyPendingNavigation()
+{
+    if (isDebounceTimerArmed)
+    {
+        isDebounceTimerArmed = false;
+        debounceTimer.cancel();
+    }
+
+    if (pendingOffset != 0)
+    {
+        const int offset = pendingOffset;
+        pendingOffset = 0;
+        stateManager->processPanelNavigation(offset);
     }
 }
 
-} // namespace panel
\ No newline at end of file
+} // namespace panel
@@ -0,0 +1,93 @@
+#include "callout.hpp"
+
+#include <algorithm>
+
+namespace panel
+{
+namespace
+{
+/* Position of the procedure or part number in line 1. */
+constexpr size_t numberOffset = 3;
+
+/**
+ * @brief Copy a value to a line, truncated to the end of the line.
+ * @param[in] value - Value to copy.
+ * @param[in] offset - Position in the line to copy to.
+ * @param[out] line - Line to copy to.
+ */
+void copyToLine(std::string_view value, const size_t offset,
+                CallOut::Line& line)
+{
+    std::copy_n(value.begin(), std::min(value.size(), line.size() - offset),
+                line.begin() + offset);
+}
+} // namespace
+
+bool CallOut::isBlank() const
+{
+    constexpr auto isSpace = [](const char lineChar) {
+        return lineChar == ' ';
+    };
+    return std::all_of(line1.begin(), line1.end(), isSpace) &&
+           std::all_of(line2.begin(), line2.end(), isSpace);
+}
+
+CallOut CallOut::parse(std::string_view callOut)
+{
+    CallOut rendered;
+    rendered.line1.fill(' ');
+    rendered.line2.fill(' ');
+
+    // Properties are separated by "," and a property name from its value by
+    // ":". Values start with a space.
+    while (!callOut.empty())
+    {
+        const auto propertyEnd = callOut.find(',');
+        const auto property = callOut.substr(0, propertyEnd);
+        callOut = (propertyEnd == std::string_view::npos)
+                      ? std::string_view{}
+                      : callOut.substr(propertyEnd + 1);
+
+        const auto nameEnd = property.find(':');
+        if (nameEnd == std::string_view::npos)
+        {
+            continue;
+        }
+        const auto name = property.substr(0, nameEnd);
+        auto value = property.substr(nameEnd + 1);
+        value = value.substr(0, value.find(':'));
+        value.remove_prefix(std::min<size_t>(1, value.size()));
+
+        if (name.find("Priority") != std::string_view::npos)
+        {
+            // Only the first letter of the priority is displayed.
+            copyToLine(value.substr(0, 1), 0, rendered.line1);
+        }
+        else if (name.find("Procedure") != std::string_view::npos ||
+                 name.find("PN") != std::string_view::npos)
+        {
+            rendered.line1[numberOffset - 1] = '-';
+            copyToLine(value, numberOffset, rendered.line1);
+        }
+        else if (name.find("Location Code") != std::string_view::npos)
+        {
+            copyToLine(value, 0, rendered.line2);
+        }
+        // TODO: Currently, CCIN is not in data recieved from D-Bus.
+    }
+    return rendered;
+}
+
+std::vector<CallOut> CallOut::parseResolution(std::string_view resolution)
+{
+    std::vector<CallOut> callOuts;
+    size_t lineEnd = 0;
+    while (callOuts.size() < maxCallOuts &&
+           (lineEnd = resolution.find('\n')) != std::string_view::npos)
+    {
+        callOuts.push_back(parse(resolution.substr(0, lineEnd)));
+        resolution.remove_prefix(lineEnd + 1);
+    }
+    return callOuts;
+}
+} // namespace panel
@@ -0,0 +1,100 @@
+#include "display.hpp"
+
+#include "const.hpp"
+#include "logger.hpp"
+#include "utils.hpp"
+
+namespace panel
+{
+namespace display
+{
+void Renderer::show(const Layer layer, std::string_view line1,
+                    std::string_view line2)
+{
+    // Lines are copied into the storage of the layer, no allocation once the
+    // layer has held a full frame.
+    auto& frame = layers.at(static_cast<size_t>(layer));
+    frame.line1.assign(line1);
+    frame.line2.assign(line2);
+    activeLayer = layer;
+
+    requestFlush();
+}
+
+void Renderer::lampTest()
+{
+    // Lamp test is a panel command, not a frame. Send it right away.
+    utils::doLampTest(transport);
+    isPanelFrameValid = false;
+}
+
+void Renderer::setLampTest(const bool state)
+{
+    if (state == isLampTestActive)
+    {
+        return;
+    }
+    isLampTestActive = state;
+
+    if (state)
+    {
+        lampTest();
+        return;
+    }
+
+    // Panel needs the model displayed again.
+    requestFlush();
+}
+
+void Renderer::requestFlush()
+{
+    if (isLampTestActive || isFlushPending)
+    {
+        return;
+    }
+
+    const auto nextFlushTime = lastFlushTime + constants::displayFrameInterval;
+    if (std::chrono::steady_clock::now() >= nextFlushTime)
+    {
+        flush();
+        return;
+    }
+
+    isFlushPending = true;
+    frameTimer.expires_at(nextFlushTime);
+    frameTimer.async_wait([this](const boost::system::error_code& ec) {
+        isFlushPending = false;
+        if (ec == boost::asio::error::operation_aborted)
+        {
+            return;
+        }
+
+        if (ec)
+        {
+            Logger::log(Logger::Subsystem::TRANSPORT, Logger::ERROR,
+                        "Display frame timer failed. {}", ec.message());
+        }
+        flush();
+    });
+}
+
+void Renderer::flush()
+{
+    if (isLampTestActive)
+    {
+        return;
+    }
+
+    const auto& frame = getFrame();
+    if (isPanelFrameValid && frame == panelFrame)
+    {
+        return;
+    }
+
+    utils::sendCurrDisplayToPanel(frame.line1, frame.line2, transport);
+    panelFrame = frame;
+    isPanelFrameValid = true;
+    lastFlushTime = std::chrono::steady_clock::now();
+}
+} // namespace display
+} // namespace panel
@@ -0,0 +1,199 @@
+#include "event_recorder.hpp"
+
+#include "logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+namespace panel
+{
+namespace record
+{
+namespace
+{
+/* Identifies a recording file. */
+constexpr std::array<char, 6> magic{'P', 'N', 'L', 'R', 'E', 'C'};
+
+/* Version of the record layout. */
+constexpr uint16_t version = 1;
+
+/* Record header: timestamp in ns, event type, payload length. */
+constexpr size_t recordHeaderSize =
+    sizeof(int64_t) + sizeof(uint8_t) + sizeof(uint32_t);
+} // namespace
+
+const char* toString(const EventType type)
+{
+    switch (type)
+    {
+        case EventType::BUTTON:
+            return "Button";
+        case EventType::PANEL_PRESENCE:
+            return "PanelPresence";
+        case EventType::PEL_ADDED:
+            return "PELAdded";
+        case EventType::PEL_REMOVED:
+            return "PELRemoved";
+        case EventType::PROGRESS_CODE:
+            return "ProgressCode";
+        case EventType::BMC_STATE:
+            return "BMCState";
+        case EventType::POWER_STATE:
+            return "PowerState";
+        case EventType::BOOT_PROGRESS:
+            return "BootProgress";
+        case EventType::OPERATING_MODE:
+            return "OperatingMode";
+        case EventType::DISPLAY:
+            return "Display";
+        case EventType::LAMP_TEST:
+            return "TriggerPanelLampTest";
+        case EventType::TOGGLE_FUNCTION_STATE:
+            return "toggleFunctionState";
+        case EventType::PROCESS_BUTTON:
+            return "ProcessButton";
+        case EventType::EXECUTE_FUNCTION:
+            return "ExecuteFunction";
+        case EventType::GET_ENABLED_FUNCTIONS:
+            return "getEnabledFunctions";
+        case EventType::OS_IPL_MODE:
+            return "OSIPLMode";
+    }
+    return "Unknown";
+}
+
+Payload& Payload::operator<<(const std::string& value)
+{
+    const auto size = static_cast<uint16_t>(
+        std::min(value.size(), size_t{std::numeric_limits<uint16_t>::max()}));
+    *this << size;
+    bytes.insert(bytes.end(), value.begin(), value.begin() + size);
+    return *this;
+}
+
+Payload& Payload::operator<<(const types::Binary& value)
+{
+    const auto size = static_cast<uint16_t>(
+        std::min(value.size(), size_t{std::numeric_limits<uint16_t>::max()}));
+    *this << size;
+    bytes.insert(bytes.end(), value.begin(), value.begin() + size);
+    return *this;
+}
+
+Payload& Payload::operator>>(std::string& value)
+{
+    uint16_t size = 0;
+    *this >> size;
+    const auto* start = take(size);
+    value.assign(start, start + size);
+    return *this;
+}
+
+Payload& Payload::operator>>(types::Binary& value)
+{
+    uint16_t size = 0;
+    *this >> size;
+    const auto* start = take(size);
+    value.assign(start, start + size);
+    return *this;
+}
+
+const types::Byte* Payload::take(const size_t size)
+{
+    if (bytes.size() - readPos < size)
+    {
+        throw std::runtime_error("Recorded event is truncated");
+    }
+    const auto* start = bytes.data() + readPos;
+    readPos += size;
+    return start;
+}
+
+void Recorder::start(const std::string& path)
+{
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Failed to open recording file " + path);
+    }
+
+    file.write(magic.data(), magic.size());
+    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    file.flush();
+
+    startTime = std::chrono::steady_clock::now();
+}
+
+void Recorder::write(const EventType type, const Payload& payload)
+{
+    const int64_t timestamp =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - startTime)
+            .count();
+    const auto eventType = static_cast<uint8_t>(type);
+    const auto length = static_cast<uint32_t>(payload.data().size());
+
+    file.write(reinterpret_cast<const char*>(&timestamp), sizeof(timestamp));
+    file.write(reinterpret_cast<const char*>(&eventType), sizeof(eventType));
+    file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    file.write(reinterpret_cast<const char*>(payload.data().data()), length);
+    file.flush();
+}
+
+Recorder& recorder()
+{
+    static Recorder appRecorder;
+    return appRecorder;
+}
+
+std::vector<Event> load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Failed to open recording file " + path);
+    }
+
+    std::array<char, magic.size()> fileMagic{};
+    uint16_t fileVersion = 0;
+    file.read(fileMagic.data(), fileMagic.size());
+    file.read(reinterpret_cast<char*>(&fileVersion), sizeof(fileVersion));
+    if (!file || fileMagic != magic || fileVersion != version)
+    {
+        throw std::runtime_error(path + " is not a panel recording");
+    }
+
+    std::vector<Event> events;
+    std::array<char, recordHeaderSize> header{};
+    while (file.read(header.data(), header.size()))
+    {
+        int64_t timestamp = 0;
+        uint8_t eventType = 0;
+        uint32_t length = 0;
+        std::memcpy(&timestamp, header.data(), sizeof(timestamp));
+        std::memcpy(&eventType, header.data() + sizeof(timestamp),
+                    sizeof(eventType));
+        std::memcpy(&length,
+                    header.data() + sizeof(timestamp) + sizeof(eventType),
+                    sizeof(length));
+
+        types::Binary payload(length);
+        if (!file.read(reinterpret_cast<char*>(payload.data()), length))
+        {
+            // Last record is incomplete if the app was killed mid write.
+            Logger::log(Logger::Subsystem::APP, Logger::ERROR,
+                        "Ignoring truncated record at the end of {}", path);
+            break;
+        }
+
+        events.push_back({std::chrono::nanoseconds(timestamp),
+                          static_cast<EventType>(eventType),
+                          Payload(std::move(payload))});
+    }
+    return events;
+}
+
+} // namespace record
+} // namespace panel
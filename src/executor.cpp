@@ -1,8 +1,12 @@
 #include "executor.hpp"
 
+#include "bios_attributes.hpp"
 #include "const.hpp"
 #include "exception.hpp"
+#include "function_registry.hpp"
+#include "logger.hpp"
 #include "pldm_fw.hpp"
+#include "progress_timeline.hpp"
 #include "utils.hpp"
 
 #include <boost/algorithm/string.hpp>
@@ -12,9 +16,15 @@
 
 namespace panel
 {
-void Executor::displayExecutionStatus(
+/* Error recorded for a function PHYP failed or did not respond to. */
+static constexpr auto phypFailure = "PHYP failed or did not respond";
+
+/* Subsystem the executor logs as. */
+static constexpr auto logSubsystem = Logger::Subsystem::EXECUTOR;
+
+std::string Executor::getFunctionPrefix(
     const types::FunctionNumber funcNumber,
-    const types::FunctionalityList& subFuncNumber, const bool result)
+    const types::FunctionalityList& subFuncNumber) const
 {
     std::ostringstream convert;
     convert << std::setfill('0') << std::setw(2)
@@ -29,16 +39,74 @@ void Executor::displayExecutionStatus(
     {
         convert << "   ";
     }
+    return convert.str();
+}
 
-    convert << (result ? " 00" : " FF");
+std::string
+    Executor::getExecutionStatus(const types::FunctionNumber funcNumber,
+                                 const types::FunctionalityList& subFuncNumber,
+                                 const bool result) const
+{
+    return getFunctionPrefix(funcNumber, subFuncNumber) +
+           (result ? " 00" : " FF");
+}
 
-    if (isExternallyTriggered)
+void Executor::displayExecutionStatus(
+    const types::FunctionNumber funcNumber,
+    const types::FunctionalityList& subFuncNumber, const bool result)
+{
+    renderer.show(display::Layer::OVERLAY,
+                  getExecutionStatus(funcNumber, subFuncNumber, result), "");
+}
+
+void Executor::runJob(const types::FunctionNumber funcNumber,
+                      const types::FunctionalityList& subFuncNumber, Job job)
+{
+    // Outcome is recorded once the job completes, an ignored execution is
+    // not recorded.
+    isOutcomeDeferred = true;
+
+    if (runningJobs.test(funcNumber))
     {
-        executionStatus = std::make_tuple(result, convert.str(), "");
+        Logger::log(logSubsystem, Logger::INFO,
+                    "Function {} is in progress, execution ignored",
+                    funcNumber);
         return;
     }
 
-    utils::sendCurrDisplayToPanel(convert.str(), "", transport);
+    runningJobs.set(funcNumber);
+    renderer.show(display::Layer::OVERLAY,
+                  getFunctionPrefix(funcNumber, subFuncNumber), "IN PROGRESS");
+
+    JobDone done = [this, funcNumber, subFuncNumber,
+                    start = std::chrono::steady_clock::now()](bool success) {
+        runningJobs.reset(funcNumber);
+        telemetry.record(funcNumber, std::chrono::steady_clock::now() - start,
+                         success ? "" : "Job failed");
+        displayExecutionStatus(funcNumber, subFuncNumber, success);
+        if (jobListener)
+        {
+            jobListener(funcNumber, subFuncNumber, success);
+        }
+    };
+
+    try
+    {
+        if (jobStarter)
+        {
+            jobStarter(funcNumber, std::move(job), std::move(done));
+        }
+        else
+        {
+            job(std::move(done));
+        }
+    }
+    catch (...)
+    {
+        // Job failed to start, failure is reported by executeFunction.
+        runningJobs.reset(funcNumber);
+        throw;
+    }
 }
 
 void Executor::executeFunction(const types::FunctionNumber funcNumber,
@@ -46,8 +114,8 @@ void Executor::executeFunction(const types::FunctionNumber funcNumber,
 {
     if (!subFuncNumber.empty())
     {
-        std::cout << "Sub function executed = " << (int)subFuncNumber.at(0)
-                  << std::endl;
+        Logger::log(logSubsystem, Logger::DEBUG, "Sub function executed = {}",
+                    subFuncNumber.at(0));
     }
 
     // If function 25 has been executed last and the current requested function
@@ -60,114 +128,28 @@ void Executor::executeFunction(const types::FunctionNumber funcNumber,
         serviceSwitch1State = false;
     }
 
+    const auto start = std::chrono::steady_clock::now();
+    isOutcomeDeferred = false;
+
     try
     {
-        switch (funcNumber)
+        const auto function = functions::Registry::find(funcNumber);
+        if (function != nullptr)
         {
-            case 1:
-                execute01();
-                break;
-
-            case 2:
-                execute02(subFuncNumber);
-                break;
-
-            case 3:
-                execute03();
-                break;
-
-            case 4:
-                execute04();
-                break;
-
-            case 8:
-                execute08();
-                break;
-
-            case 11:
-                execute11();
-                break;
-
-            case 12:
-                execute12();
-                break;
-
-            case 13:
-                execute13();
-                break;
-
-            case 14:
-            case 15:
-            case 16:
-            case 17:
-            case 18:
-            case 19:
-                execute14to19(funcNumber);
-                break;
-            case 20:
-                execute20();
-                break;
-
-            case 21:
-            case 22:
-            case 34:
-            case 41:
-            case 65:
-            case 66:
-            case 67:
-            case 68:
-            case 69:
-            case 70:
-                sendFuncNumToPhyp(funcNumber);
-                break;
-
-            case 25:
-                execute25();
-                break;
-
-            case 26:
-                execute26();
-                break;
-
-            case 30:
-                execute30(subFuncNumber);
-                break;
-
-            case 42:
-                execute42();
-                break;
-
-            case 43:
-                execute43();
-                break;
-
-            case 55:
-                execute55(subFuncNumber);
-                break;
-
-            case 63:
-                execute63(subFuncNumber.at(0));
-                break;
-
-            case 64:
-                execute64(subFuncNumber.at(0));
-                break;
-
-            case 73:
-                execute73();
-                break;
-
-            case 74:
-                execute74();
-                break;
-
-            default:
-                break;
+            function->handler(*this, funcNumber, subFuncNumber);
+
+            if (!isOutcomeDeferred)
+            {
+                telemetry.record(funcNumber,
+                                 std::chrono::steady_clock::now() - start);
+            }
         }
     }
     catch (BaseException& e)
     {
-        std::cerr << e.what() << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR, "{}", e.what());
+        telemetry.record(funcNumber, std::chrono::steady_clock::now() - start,
+                         e.what());
         displayExecutionStatus(funcNumber, subFuncNumber, false);
 
         // In case of function 02, if there is any exception, throw it
@@ -179,7 +161,9 @@ void Executor::executeFunction(const types::FunctionNumber funcNumber,
     }
     catch (const sdbusplus::exception::SdBusError& e)
     {
-        std::cerr << e.what() << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR, "{}", e.what());
+        telemetry.record(funcNumber, std::chrono::steady_clock::now() - start,
+                         e.what());
         displayExecutionStatus(funcNumber, subFuncNumber, false);
 
         // In case of function 02, if there is any Dbus read/write error, throw
@@ -192,7 +176,10 @@ void Executor::executeFunction(const types::FunctionNumber funcNumber,
     }
     catch (const boost::system::system_error& err)
     {
-        std::cerr << "Boost throwing exception" << err.what() << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR, "Boost throwing exception{}",
+                    err.what());
+        telemetry.record(funcNumber, std::chrono::steady_clock::now() - start,
+                         err.what());
         displayExecutionStatus(funcNumber, subFuncNumber, false);
     }
 }
@@ -204,7 +191,7 @@ void Executor::execute03()
         "xyz.openbmc_project.State.Host", "RequestedHostTransition",
         "xyz.openbmc_project.State.Host.Transition.GracefulWarmReboot");
 
-    utils::sendCurrDisplayToPanel("RESTART SERVER", "INITIATED", transport);
+    renderer.show(display::Layer::OVERLAY, "RESTART SERVER", "INITIATED");
 }
 
 void Executor::execute25()
@@ -281,32 +268,20 @@ void Executor::execute20()
     {
         throw FunctionFailure("Function 20 failed.");
     }
-    utils::sendCurrDisplayToPanel(line1, line2, transport);
+    renderer.show(display::Layer::OVERLAY, line1, line2);
 }
 
 void Executor::execute11()
 {
-    if (!latestSrcAndHexwords.empty())
+    if (latestSrc)
     {
-        // find the first space to get response code
-        auto pos = latestSrcAndHexwords.find_first_of(" ");
-
-        // length of src data need to be 8
-        if (pos != std::string::npos && pos == 8)
-        {
-            utils::sendCurrDisplayToPanel((latestSrcAndHexwords).substr(0, pos),
-                                          std::string{}, transport);
-        }
-        else
-        {
-            std::cerr << "Invalid srcData received = " << latestSrcAndHexwords
-                      << std::endl;
-        }
+        renderer.show(display::Layer::OVERLAY, latestSrc->getSrc(),
+                      std::string_view{});
         return;
     }
 
     // TODO: Decide what needs to be done in this case.
-    std::cerr << "Error getting SRC data" << std::endl;
+    Logger::log(logSubsystem, Logger::ERROR, "Error getting SRC data");
 }
 
 static std::string getEthLocPort(const std::string& macAddr)
@@ -344,9 +319,10 @@ static std::string getEthLocPort(const std::string& macAddr)
 
                     if (pos == std::string::npos)
                     {
-                        std::cerr << "\n Unable to find location port in this "
-                                     "location code "
-                                  << locCode << " for " << obj << std::endl;
+                        Logger::log(logSubsystem, Logger::ERROR,
+                                    "Unable to find location port in this "
+                                    "location code {} for {}",
+                                    locCode, obj);
                         return std::string();
                     }
                     else
@@ -356,17 +332,18 @@ static std::string getEthLocPort(const std::string& macAddr)
                 }
                 else
                 {
-                    std::cerr << "\n Unable to find location code for " << obj
-                              << std::endl;
+                    Logger::log(logSubsystem, Logger::ERROR,
+                                "Unable to find location code for {}", obj);
                     return std::string();
                 }
             }
         }
     }
 
-    std::cerr << "No matching MAC address(from Network Manager) " << macAddr
-              << " found in Inventory Manager for any ethernet objects."
-              << std::endl;
+    Logger::log(logSubsystem, Logger::ERROR,
+                "No matching MAC address(from Network Manager) {} found in "
+                "Inventory Manager for any ethernet objects.",
+                macAddr);
     return {};
 }
 
@@ -465,12 +442,14 @@ void Executor::execute30(const types::FunctionalityList& subFuncNumber)
                 });
             if (intfItr == intfPropVector.end())
             {
-                std::cerr << "Mac address interface not found." << std::endl;
+                Logger::log(logSubsystem, Logger::ERROR,
+                            "Mac address interface not found.");
             }
             const auto& macAddrItr = intfItr->second.find("MACAddress");
             if (macAddrItr == intfItr->second.end())
             {
-                std::cerr << "MACAddress property not found." << std::endl;
+                Logger::log(logSubsystem, Logger::ERROR,
+                            "MACAddress property not found.");
             }
             if (auto mac = std::get_if<std::string>(&(macAddrItr->second)))
             {
@@ -500,12 +479,12 @@ void Executor::execute30(const types::FunctionalityList& subFuncNumber)
     line1 += boost::to_upper_copy<std::string>(ethPort);
     line1 += ":     ";
     line1 += locCode;
-    panel::utils::sendCurrDisplayToPanel(line1, line2, transport);
+    renderer.show(display::Layer::OVERLAY, line1, line2);
 }
 
 void Executor::execute01()
 {
-    const auto sysValues = utils::readSystemParameters();
+    auto& biosAttributes = bios::attributes();
 
     std::string line1(16, ' ');
     std::string line2(16, ' ');
@@ -513,25 +492,29 @@ void Executor::execute01()
     if (osIplMode)
     {
         // OS IPL Type
-        line1.replace(4, 1, std::get<0>(sysValues).substr(0, 1));
+        line1.replace(
+            4, 1,
+            biosAttributes.get(bios::Attribute::OS_BOOT_TYPE).substr(0, 1));
     }
 
     // Operating mode
-    line1.replace(7, 1, std::get<1>(sysValues).substr(0, 1));
+    const auto& operatingMode =
+        biosAttributes.get(bios::Attribute::SYSTEM_OPERATING_MODE);
+    line1.replace(7, 1, operatingMode.substr(0, 1));
 
     // hypervisor type
-    if (std::get<4>(sysValues) == "PowerVM")
+    const auto& hypType = biosAttributes.get(bios::Attribute::HYP_SWITCH);
+    if (hypType == "PowerVM")
     {
         line1.replace(12, 3, "PVM");
     }
     else
     {
-        line1.replace(12, std::get<4>(sysValues).length(),
-                      std::get<4>(sysValues));
+        line1.replace(12, hypType.length(), hypType);
     }
 
     // HMC Managed
-    if (std::get<2>(sysValues) == "Enabled")
+    if (biosAttributes.get(bios::Attribute::HMC_MANAGED) == "Enabled")
     {
         line2.replace(0, 5, "HMC=1");
     }
@@ -551,146 +534,48 @@ void Executor::execute01()
     // function number
     line1.replace(0, 2, "01");
 
-    utils::sendCurrDisplayToPanel(line1, line2, transport);
+    renderer.show(display::Layer::OVERLAY, line1, line2);
     return;
 }
 
 void Executor::execute12()
 {
     // Need to show blank spaces in case no srcData as function is enabled.
-    constexpr auto blankHexWord = "        ";
-    std::vector<std::string> output(4, blankHexWord);
+    SrcRecord::HexWordLine line1;
+    SrcRecord::HexWordLine line2;
+    const auto& srcRecord = latestSrc.value_or(SrcRecord{});
 
-    if (!latestSrcAndHexwords.empty())
-    {
-        std::vector<std::string> src;
-        boost::split(src, latestSrcAndHexwords, boost::is_any_of(" "));
-
-        const auto size = std::min(src.size(), (size_t)5);
-        // ignoring the first hexword as that will be SRC.
-        for (size_t i = 1; i < size; ++i)
-        {
-            output[i - 1] = src[i];
-        }
-    }
-
-    // send blank display if string is empty
-    utils::sendCurrDisplayToPanel((output.at(0) + output.at(1)),
-                                  (output.at(2) + output.at(3)), transport);
+    // hexwords 2 to 5.
+    renderer.show(display::Layer::OVERLAY, srcRecord.toHexWordLine(0, line1),
+                  srcRecord.toHexWordLine(2, line2));
 }
 
 void Executor::execute13()
 {
     // Need to show blank spaces in case of no hex word as function is
     // enabled.
-    constexpr auto blankHexWord = "        ";
-    std::vector<std::string> output(4, blankHexWord);
-
-    if (!latestSrcAndHexwords.empty())
-    {
-        std::vector<std::string> src;
-        boost::split(src, latestSrcAndHexwords, boost::is_any_of(" "));
-
-        const auto size = std::min(src.size(), (size_t)9);
-        // ignoring the first five hexword
-        for (size_t i = 5; i < size; ++i)
-        {
-            output[i - 5] = src[i];
-        }
-    }
+    SrcRecord::HexWordLine line1;
+    SrcRecord::HexWordLine line2;
+    const auto& srcRecord = latestSrc.value_or(SrcRecord{});
 
-    // send blank display if string is empty
-    utils::sendCurrDisplayToPanel((output.at(0) + output.at(1)),
-                                  (output.at(2) + output.at(3)), transport);
+    // hexwords 6 to 9.
+    renderer.show(display::Layer::OVERLAY, srcRecord.toHexWordLine(4, line1),
+                  srcRecord.toHexWordLine(6, line2));
 }
 
 void Executor::execute14to19(const types::FunctionNumber funcNumber)
 {
-    std::string aCallOut{};
-    std::string line1(16, ' ');
-    std::string line2(16, ' ');
-
-    switch (funcNumber)
-    {
-        // size check is not done here as functions are enabled based on
-        // count of entries in this vector.
-        case 14:
-            aCallOut = callOutList.at(0);
-            break;
-
-        case 15:
-            aCallOut = callOutList.at(1);
-            break;
-
-        case 16:
-            aCallOut = callOutList.at(2);
-            break;
-
-        case 17:
-            aCallOut = callOutList.at(3);
-            break;
-
-        case 18:
-            aCallOut = callOutList.at(4);
-            break;
-
-        case 19:
-            aCallOut = callOutList.at(5);
-            break;
-    }
-
-    // sample resolution string in case of procedure callout
-    // 1. Priority: High, Procedure: BMCSP02
-    // output:
-    // L1 : H -BMCSP02
-    // L2 :
-
-    // sample resolution string in hardware callout
-    // 1. Location Code: U78DA.ND0.1234567-P0, Priority: Medium, PN: SVCDOCS
-    // output:
-    // L1 : M -SVCDOCS
-    // L2 : U78DA.ND0.1234567-P0
-
-    std::vector<std::string> callOutPropertyList;
-    boost::split(callOutPropertyList, aCallOut, boost::is_any_of(","));
-
-    for (auto& aProperty : callOutPropertyList)
-    {
-        std::vector<std::string> propValueList;
-        boost::split(propValueList, aProperty, boost::is_any_of(":"));
-
-        size_t pos = std::string::npos;
-        if ((pos = propValueList[0].find("Priority")) != std::string::npos)
-        {
-            line1.replace(0, 1, propValueList[1].substr(1, 1));
-        }
-        else if ((pos = propValueList[0].find("Procedure")) !=
-                 std::string::npos)
-        {
-            line1.replace(2, 1, "-");
-            line1.replace(3, 7, propValueList[1].substr(1));
-        }
-        else if ((pos = propValueList[0].find("Location Code")) !=
-                 std::string::npos)
-        {
-            line2.replace(0, (propValueList[1].substr(1)).length(),
-                          propValueList[1].substr(1));
-        }
-        else if ((pos = propValueList[0].find("PN")) != std::string::npos)
-        {
-            line1.replace(2, 1, "-");
-            line1.replace(3, 7, propValueList[1].substr(1));
-        }
-        // TODO: Currently, CCIN is not in data recieved from D-Bus.
-    }
+    // size check is not done here as functions are enabled based on count of
+    // entries in this vector.
+    const auto& callOut = callOutList.at(funcNumber - 14);
 
-    if ((line1.compare(std::string(16, ' ')) == 0) &&
-        (line2.compare(std::string(16, ' ')) == 0))
+    if (callOut.isBlank())
     {
         throw FunctionFailure(
             "Failed parsing resolution string during callout.");
     }
-    utils::sendCurrDisplayToPanel(line1, line2, transport);
+    renderer.show(display::Layer::OVERLAY, callOut.getLine1(),
+                  callOut.getLine2());
 }
 static std::string getIplType(const uint8_t index)
 {
@@ -707,8 +592,72 @@ static std::string getIplType(const uint8_t index)
     }
 }
 
+/**
+ * @brief Get a job setting a D-Bus property.
+ * @param[in] conn - D-Bus connection.
+ * @param[in] service - Service name.
+ * @param[in] object - Object path.
+ * @param[in] interface - Interface of the property.
+ * @param[in] property - Property name.
+ * @param[in] value - Value to set.
+ * @return Job completing once the property is set.
+ */
+template <typename T>
+static Executor::Job
+    setPropertyJob(std::shared_ptr<sdbusplus::asio::connection> conn,
+                   const std::string& service, const std::string& object,
+                   const std::string& interface, const std::string& property,
+                   T value)
+{
+    return [conn, service, object, interface, property,
+            value = std::move(value)](Executor::JobDone done) {
+        conn->async_method_call(
+            [property, done](const boost::system::error_code& ec) {
+                if (ec)
+                {
+                    Logger::log(logSubsystem, Logger::ERROR,
+                                "Failed to set {}. {}", property,
+                                ec.message());
+                }
+                done(!ec);
+            },
+            service, object, "org.freedesktop.DBus.Properties", "Set",
+            interface, property, std::variant<T>(value));
+    };
+}
+
+/**
+ * @brief Run jobs one after the other.
+ * Jobs after a failed one are not run.
+ *
+ * @param[in] jobs - Jobs to run.
+ * @param[in] done - Called once all the jobs complete or one fails.
+ */
+static void runInSequence(std::deque<Executor::Job> jobs,
+                          Executor::JobDone done)
+{
+    if (jobs.empty())
+    {
+        done(true);
+        return;
+    }
+
+    auto job = std::move(jobs.front());
+    jobs.pop_front();
+    job([jobs = std::move(jobs), done](bool success) mutable {
+        if (!success)
+        {
+            done(false);
+            return;
+        }
+        runInSequence(std::move(jobs), std::move(done));
+    });
+}
+
 static types::PendingAttributesItemType
-    setOperatingMode(const uint8_t sysOperatingModeIndex)
+    setOperatingMode(const uint8_t sysOperatingModeIndex,
+                     std::shared_ptr<sdbusplus::asio::connection>& conn,
+                     std::deque<Executor::Job>& jobs)
 {
     // Normal mode is the default mode hence all the defaul values are as
     // per normal mode.
@@ -725,17 +674,17 @@ static types::PendingAttributesItemType
         autoReboot = false;
     }
 
-    utils::writeBusProperty<std::string>(
-        "xyz.openbmc_project.Settings",
+    jobs.push_back(setPropertyJob<std::string>(
+        conn, "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/control/host0/power_restore_policy",
         "xyz.openbmc_project.Control.Power.RestorePolicy", "PowerRestorePolicy",
-        PowerRestorePolicy);
+        PowerRestorePolicy));
 
-    utils::writeBusProperty<bool>(
-        "xyz.openbmc_project.Settings",
+    jobs.push_back(setPropertyJob<bool>(
+        conn, "xyz.openbmc_project.Settings",
         "/xyz/openbmc_project/control/host0/auto_reboot",
         "xyz.openbmc_project.Control.Boot.RebootPolicy", "AutoReboot",
-        autoReboot);
+        autoReboot));
 
     return std::make_pair(
         "pvm_system_operating_mode",
@@ -752,6 +701,9 @@ void Executor::execute02(const types::FunctionalityList& subFuncNumber)
     // BIOS table attribute list.
     types::PendingAttributesType listOfAttributeValue;
 
+    // Settings writes, followed by the BIOS table write.
+    std::deque<Job> jobs;
+
     // change is needed only when state is not invalid.
     if (subFuncNumber.at(0) != invalidState)
     {
@@ -764,7 +716,8 @@ void Executor::execute02(const types::FunctionalityList& subFuncNumber)
 
     if (subFuncNumber.at(1) != invalidState)
     {
-        listOfAttributeValue.push_back(setOperatingMode(subFuncNumber.at(1)));
+        listOfAttributeValue.push_back(
+            setOperatingMode(subFuncNumber.at(1), conn, jobs));
     }
 
     // Process boot side switch only when state is not invalid. Implies
@@ -785,56 +738,82 @@ void Executor::execute02(const types::FunctionalityList& subFuncNumber)
 
     if (listOfAttributeValue.size() > 0)
     {
-        utils::writeBusProperty<types::PendingAttributesType>(
-            "xyz.openbmc_project.BIOSConfigManager",
+        jobs.push_back(setPropertyJob<types::PendingAttributesType>(
+            conn, "xyz.openbmc_project.BIOSConfigManager",
             "/xyz/openbmc_project/bios_config/manager",
             "xyz.openbmc_project.BIOSConfig.Manager", "PendingAttributes",
-            std::move(listOfAttributeValue));
+            std::move(listOfAttributeValue)));
     }
+
+    runJob(2, subFuncNumber, [jobs = std::move(jobs)](JobDone done) mutable {
+        runInSequence(std::move(jobs), std::move(done));
+    });
 }
 
-void Executor::storeIPLSRC(const std::string& progressCode)
+void Executor::storeIPLSRC(const SrcRecord& progressCode)
 {
-    // Need to store last 25 IPL SRCs.
-    if (iplSrcs.size() == 25)
-    {
-        iplSrcs.pop_front();
-    }
-    iplSrcs.push_back(progressCode);
+    // Timeline file is memory mapped, it is kept across restarts without a
+    // snapshot.
+    timeline::store().append(progressCode);
+}
+
+uint8_t Executor::getIPLSRCCount() const
+{
+    return static_cast<uint8_t>(
+        std::min(timeline::store().size(), SrcHistory::capacity));
 }
 
 void Executor::execute63(const types::FunctionNumber subFuncNumber)
 {
+    const auto count = getIPLSRCCount();
+
     // 0th Sub function is always enabled and should show blank screen if
     // required.
-    if ((subFuncNumber == 0) && (iplSrcs.size() == 0))
+    if ((subFuncNumber == 0) && (count == 0))
     {
-        utils::sendCurrDisplayToPanel(std::string{}, std::string{}, transport);
+        renderer.show(display::Layer::OVERLAY, std::string{},
+                      std::string{});
         return;
     }
     else
     {
-        if ((iplSrcs.size() - 1) >= subFuncNumber)
+        if (subFuncNumber < count)
         {
-            utils::sendCurrDisplayToPanel(iplSrcs.at(subFuncNumber),
-                                          std::string{}, transport);
+            // Sub function 00 is the oldest of the last 25 codes.
+            const auto& timeline = timeline::store();
+            const auto entry =
+                timeline.at(timeline.size() - count + subFuncNumber);
+            renderer.show(display::Layer::OVERLAY,
+                          std::string{entry.toSrcRecord().getSrc()},
+                          std::string{});
             return;
         }
     }
 
-    std::cerr << "Sub function number should not have been enabled"
-              << std::endl;
+    Logger::log(logSubsystem, Logger::ERROR,
+                "Sub function number should not have been enabled");
 }
 
 void Executor::storePelEventId(const std::string& pelEventId)
 {
-    // Need to store last 25 PEL SRCs.
-    if (pelEventIdQueue.size() == 25)
-    {
-        pelEventIdQueue.pop_front();
-    }
-    pelEventIdQueue.push_back(pelEventId);
-    latestSrcAndHexwords = pelEventId;
+    // Need to store last 25 PEL SRCs, oldest is dropped once full.
+    pelSrcs.push(SrcRecord::fromEventId(pelEventId));
+    latestSrc = pelSrcs.back();
+    snapshot::store().markDirty();
+}
+
+void Executor::saveState(snapshot::PanelState& state) const
+{
+    state.pelSrcs = pelSrcs;
+    state.latestSrc = latestSrc;
+    state.callOutList = callOutList;
+}
+
+void Executor::restoreState(const snapshot::PanelState& state)
+{
+    pelSrcs = state.pelSrcs;
+    latestSrc = state.latestSrc;
+    callOutList = state.callOutList;
 }
 
 uint8_t Executor::getPelEventIdCount()
@@ -853,38 +832,32 @@ uint8_t Executor::getPelEventIdCount()
         }
     }
 
-    return pelEventIdQueue.size();
+    return pelSrcs.size();
 }
 
 void Executor::execute64(const types::FunctionNumber subFuncNumber)
 {
     // 0th Sub function is always enabled and should show blank screen if
     // required.
-    if ((subFuncNumber == 0) && (pelEventIdQueue.size() == 0))
+    if ((subFuncNumber == 0) && pelSrcs.empty())
     {
-        utils::sendCurrDisplayToPanel(std::string{}, std::string{}, transport);
+        renderer.show(display::Layer::OVERLAY, std::string{},
+                      std::string{});
         return;
     }
     else
     {
-        if ((pelEventIdQueue.size() - 1) >= subFuncNumber)
+        if (subFuncNumber < pelSrcs.size())
         {
-            std::string_view src(pelEventIdQueue.at(subFuncNumber));
-            if (src.length() < 8)
-            {
-                std::cerr << "Bad error event data" << std::endl;
-                return;
-            }
-            // TODO: via https://github.com/ibm-openbmc/ibm-panel/issues/34.
-            // avoid temp string object creation by using a std::string_view
-            utils::sendCurrDisplayToPanel(std::string{src.substr(0, 8)},
-                                          std::string{}, transport);
+            renderer.show(display::Layer::OVERLAY,
+                          std::string{pelSrcs.at(subFuncNumber).getSrc()},
+                          std::string{});
             return;
         }
     }
 
-    std::cerr << "Sub function number should not have been enabled"
-              << std::endl;
+    Logger::log(logSubsystem, Logger::ERROR,
+                "Sub function number should not have been enabled");
 }
 
 void Executor::execute55(const types::FunctionalityList& subFuncNumber)
@@ -901,7 +874,7 @@ void Executor::execute55(const types::FunctionalityList& subFuncNumber)
         {
             std::string line1 = "5500 ";
             line1 += *val ? "01" : "02";
-            utils::sendCurrDisplayToPanel(line1, "", transport);
+            renderer.show(display::Layer::OVERLAY, line1, "");
             return;
         }
         else
@@ -909,26 +882,20 @@ void Executor::execute55(const types::FunctionalityList& subFuncNumber)
             throw FunctionFailure("Dump policy collection failed.");
         }
     }
-    else if (subFuncNumber.at(0) == 0x01) // disable dump policy
+    else if (subFuncNumber.at(0) == 0x01 ||
+             subFuncNumber.at(0) == 0x02) // disable/enable dump policy
     {
-        utils::writeBusProperty<bool>(
-            "xyz.openbmc_project.Settings",
-            "/xyz/openbmc_project/dump/system_dump_policy",
-            "xyz.openbmc_project.Object.Enable", "Enabled", false);
-    }
-    else if (subFuncNumber.at(0) == 0x02) // enable dump policy
-    {
-        utils::writeBusProperty<bool>(
-            "xyz.openbmc_project.Settings",
-            "/xyz/openbmc_project/dump/system_dump_policy",
-            "xyz.openbmc_project.Object.Enable", "Enabled", true);
+        runJob(55, subFuncNumber,
+               setPropertyJob<bool>(
+                   conn, "xyz.openbmc_project.Settings",
+                   "/xyz/openbmc_project/dump/system_dump_policy",
+                   "xyz.openbmc_project.Object.Enable", "Enabled",
+                   subFuncNumber.at(0) == 0x02));
     }
     else
     {
         throw FunctionFailure("Function 55 failed. Unsupported sub function.");
     }
-
-    displayExecutionStatus(55, subFuncNumber, true);
 }
 
 void Executor::execute08()
@@ -940,36 +907,52 @@ void Executor::execute08()
         "xyz.openbmc_project.State.Chassis", "RequestedPowerTransition",
         "xyz.openbmc_project.State.Chassis.Transition.Off");
 
-    utils::sendCurrDisplayToPanel("SHUTDOWN SERVER", "INITIATED", transport);
+    renderer.show(display::Layer::OVERLAY, "SHUTDOWN SERVER", "INITIATED");
 }
 
-static void createDump(const sdbusplus::message::object_path& object)
+/**
+ * @brief Get a job creating a dump.
+ * @param[in] conn - D-Bus connection.
+ * @param[in] object - Dump manager object of the dump type.
+ * @return Job completing once the dump manager accepts the request.
+ */
+static Executor::Job
+    createDumpJob(std::shared_ptr<sdbusplus::asio::connection> conn,
+                  const std::string& object)
 {
-    sdbusplus::message::object_path retVal{};
-    auto bus = sdbusplus::bus::new_default();
-    auto properties = bus.new_method_call(
-        "xyz.openbmc_project.Dump.Manager", std::string(object).c_str(),
-        "xyz.openbmc_project.Dump.Create", "CreateDump");
-    properties.append(
-        std::vector<
-            std::pair<std::string, std::variant<std::string, uint64_t>>>());
-    auto result = bus.call(properties);
-    result.read(retVal);
-    std::cout << "Dump initiated. " << std::string(retVal) << std::endl;
+    return [conn, object](Executor::JobDone done) {
+        conn->async_method_call(
+            [done](const boost::system::error_code& ec,
+                   const sdbusplus::message::object_path& dumpPath) {
+                if (ec)
+                {
+                    Logger::log(logSubsystem, Logger::ERROR,
+                                "Failed to create dump. {}", ec.message());
+                }
+                else
+                {
+                    Logger::log(logSubsystem, Logger::INFO,
+                                "Dump initiated. {}", std::string(dumpPath));
+                }
+                done(!ec);
+            },
+            "xyz.openbmc_project.Dump.Manager", object,
+            "xyz.openbmc_project.Dump.Create", "CreateDump",
+            std::vector<std::pair<std::string,
+                                  std::variant<std::string, uint64_t>>>());
+    };
 }
 
 void Executor::execute43()
 {
-    createDump(
-        sdbusplus::message::object_path("/xyz/openbmc_project/dump/bmc"));
-    displayExecutionStatus(43, std::vector<types::FunctionNumber>(), true);
+    runJob(43, types::FunctionalityList{},
+           createDumpJob(conn, "/xyz/openbmc_project/dump/bmc"));
 }
 
 void Executor::execute42()
 {
-    createDump(
-        sdbusplus::message::object_path("/xyz/openbmc_project/dump/system"));
-    displayExecutionStatus(42, std::vector<types::FunctionNumber>(), true);
+    runJob(42, types::FunctionalityList{},
+           createDumpJob(conn, "/xyz/openbmc_project/dump/system"));
 }
 
 void Executor::execute04()
@@ -978,39 +961,58 @@ void Executor::execute04()
                                   "/xyz/openbmc_project/led/groups/lamp_test",
                                   "xyz.openbmc_project.Led.Group", "Asserted",
                                   true);
-    utils::doLampTest(transport);
-}
-
-static void doBMCGracefulRestart()
-{
-    utils::writeBusProperty<std::string>(
-        "xyz.openbmc_project.State.BMC", "/xyz/openbmc_project/state/bmc0",
-        "xyz.openbmc_project.State.BMC", "RequestedBMCTransition",
-        "xyz.openbmc_project.State.BMC.Transition.Reboot");
+    renderer.lampTest();
 }
 
 void Executor::execute73()
 {
     // factory reset BMC by calling
     // BMC code updater factory reset followed by a BMC reboot.
-    auto bus = sdbusplus::bus::new_default();
-    auto factoryResetCall =
-        bus.new_method_call("xyz.openbmc_project.Software.BMC.Updater",
-                            "/xyz/openbmc_project/software",
-                            "xyz.openbmc_project.Common.FactoryReset", "Reset");
-
-    bus.call(factoryResetCall);
+    Job factoryReset = [conn = conn](JobDone done) {
+        conn->async_method_call(
+            [done](const boost::system::error_code& ec) {
+                if (ec)
+                {
+                    Logger::log(logSubsystem, Logger::ERROR,
+                                "Factory reset failed. {}", ec.message());
+                }
+                done(!ec);
+            },
+            "xyz.openbmc_project.Software.BMC.Updater",
+            "/xyz/openbmc_project/software",
+            "xyz.openbmc_project.Common.FactoryReset", "Reset");
+    };
 
     // Factory Reset doesn't actually happen until a reboot
-    doBMCGracefulRestart();
+    std::deque<Job> jobs{
+        std::move(factoryReset),
+        setPropertyJob<std::string>(
+            conn, "xyz.openbmc_project.State.BMC",
+            "/xyz/openbmc_project/state/bmc0", "xyz.openbmc_project.State.BMC",
+            "RequestedBMCTransition",
+            "xyz.openbmc_project.State.BMC.Transition.Reboot")};
+
+    runJob(73, types::FunctionalityList{},
+           [jobs = std::move(jobs)](JobDone done) mutable {
+               runInSequence(std::move(jobs), std::move(done));
+           });
 }
 
 void Executor::sendFuncNumToPhyp(const types::FunctionNumber& funcNumber)
 {
-    PldmFramework obj;
-    obj.sendPanelFunctionToPhyp(funcNumber);
-    displayExecutionStatus(funcNumber, std::vector<types::FunctionNumber>(),
-                           true);
+    // Outcome is recorded once PHYP responds.
+    isOutcomeDeferred = true;
+
+    pldm.sendPanelFunctionToPhyp(
+        funcNumber, [this, funcNumber,
+                     start = std::chrono::steady_clock::now()](bool status) {
+            telemetry.record(funcNumber,
+                             std::chrono::steady_clock::now() - start,
+                             status ? "" : phypFailure);
+            displayExecutionStatus(funcNumber,
+                                   std::vector<types::FunctionNumber>(),
+                                   status);
+        });
 }
 
 void Executor::execute74()
@@ -1019,8 +1021,8 @@ void Executor::execute74()
     // timer for 30 minutes
     auto asyncCancelled = timeout.expires_after(std::chrono::minutes(30));
 
-    (asyncCancelled == 0) ? std::cout << "Timer started" << std::endl
-                          : std::cout << "Timer re-started" << std::endl;
+    Logger::log(logSubsystem, Logger::INFO, "Timer {}",
+                (asyncCancelled == 0) ? "started" : "re-started");
 
     timeout.async_wait([this](const boost::system::error_code& ec) {
         if (ec == boost::asio::error::operation_aborted)
@@ -1030,7 +1032,8 @@ void Executor::execute74()
 
         if (ec)
         {
-            std::cerr << "Timer wait failed for function 74" << ec.message();
+            Logger::log(logSubsystem, Logger::ERROR,
+                        "Timer wait failed for function 74{}", ec.message());
         }
         iface->set_property("ACFWindowActive", false);
     });
@@ -1047,35 +1050,43 @@ void Executor::execute74()
 }
 
 types::ReturnStatus
-    Executor::executeFunctionDirectly(const types::FunctionNumber funcNum)
+    Executor::executeFunctionDirectly(const types::FunctionNumber funcNum,
+                                      boost::asio::yield_context yield)
 {
-    isExternallyTriggered = true;
-    try
-    {
-        switch (funcNum)
-        {
-            case 21:
-            case 22:
-            case 34:
-            case 65:
-            case 66:
-            case 67:
-            case 68:
-            case 69:
-            case 70:
-                sendFuncNumToPhyp(funcNum);
-                break;
-        }
-    }
-    catch (std::exception& e)
+    const auto function = functions::Registry::find(funcNum);
+    if (function == nullptr || !function->remoteCapable)
     {
-        isExternallyTriggered = false;
-        std::cerr << "Function " << static_cast<int>(funcNum)
-                  << " execution failed. " << e.what() << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Function {} can't be executed directly.", funcNum);
         throw sdbusplus::xyz::openbmc_project::Common::Error::InternalFailure();
     }
 
-    isExternallyTriggered = false;
-    return executionStatus;
+    const auto start = std::chrono::steady_clock::now();
+    const bool status =
+        boost::asio::async_initiate<boost::asio::yield_context, void(bool)>(
+            [this, funcNum](auto handler) {
+                // PldmFramework takes a copyable callback.
+                auto sharedHandler =
+                    std::make_shared<decltype(handler)>(std::move(handler));
+                pldm.sendPanelFunctionToPhyp(
+                    funcNum, [sharedHandler](bool result) {
+                        (*sharedHandler)(result);
+                    });
+            },
+            yield);
+
+    if (!status)
+    {
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Function {} execution failed.", funcNum);
+    }
+    telemetry.record(funcNum, std::chrono::steady_clock::now() - start,
+                     status ? "" : phypFailure);
+
+    return std::make_tuple(
+        status,
+        getExecutionStatus(funcNum, std::vector<types::FunctionNumber>(),
+                           status),
+        "");
 }
 } // namespace panel
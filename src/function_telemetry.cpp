@@ -0,0 +1,58 @@
+#include "function_telemetry.hpp"
+
+#include "latency_summary.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace panel
+{
+void FunctionTelemetry::record(
+    const types::FunctionNumber funcNumber,
+    const std::chrono::steady_clock::duration latency, const std::string& error)
+{
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(latency);
+    auto& entry = entries[funcNumber];
+
+    const auto executions = entry.successCount + entry.failureCount;
+    entry.samples[executions % sampleCount] = static_cast<uint32_t>(
+        std::min<int64_t>(elapsed.count(),
+                          std::numeric_limits<uint32_t>::max()));
+    entry.maxTime = std::max(entry.maxTime, elapsed);
+
+    if (error.empty())
+    {
+        entry.successCount++;
+    }
+    else
+    {
+        entry.failureCount++;
+        entry.lastError = error;
+    }
+}
+
+types::FunctionStatistics FunctionTelemetry::getStatistics() const
+{
+    types::FunctionStatistics statistics;
+    for (const auto& [funcNumber, entry] : entries)
+    {
+        const auto executions = entry.successCount + entry.failureCount;
+        std::vector<uint32_t> samples(
+            entry.samples.begin(),
+            entry.samples.begin() +
+                std::min<uint64_t>(executions, sampleCount));
+
+        const auto summary = summarizeLatency(std::span(samples));
+
+        statistics.emplace(
+            funcNumber,
+            std::make_tuple(entry.successCount, entry.failureCount,
+                            summary.p50, summary.p99,
+                            static_cast<uint64_t>(entry.maxTime.count()),
+                            entry.lastError));
+    }
+    return statistics;
+}
+} // namespace panel
@@ -2,12 +2,21 @@
 #include "bus_monitor.hpp"
 #include "button_handler.hpp"
 #include "const.hpp"
+#include "event_recorder.hpp"
+#include "function_registry.hpp"
+#include "logger.hpp"
+#include "progress_timeline.hpp"
+#include "signal_dispatcher.hpp"
+#include "snapshot.hpp"
 #include "utils.hpp"
 
+#include <chrono>
 #include <exception>
-#include <iostream>
+#include <filesystem>
+#include <optional>
 #include <sdbusplus/asio/connection.hpp>
 #include <sdbusplus/asio/object_server.hpp>
+#include <xyz/openbmc_project/Common/error.hpp>
 
 panel::types::PanelDataMap baseDataMap = {
     {panel::constants::rain2s2uIM,
@@ -44,6 +53,29 @@ std::string getInputDevicePath(const std::string& imValue)
     return "/dev/input/by-path/platform-1e78a080.i2c-bus-event-joystick";
 }
 
+/**
+ * @brief Api to put the emulated host at runtime.
+ * The host enables all the functions it can execute, so that they can be
+ * executed remotely.
+ *
+ * @param[in] stateManager - State manager.
+ */
+void emulateHostRuntime(panel::state::manager::PanelStateManager& stateManager)
+{
+    panel::types::FunctionalityList hostFunctions;
+    for (const auto& function : panel::functions::Registry::table)
+    {
+        if (function.remoteCapable)
+        {
+            hostFunctions.push_back(function.number);
+        }
+    }
+
+    stateManager.updateBootProgressState(
+        "xyz.openbmc_project.State.Boot.Progress.ProgressStages.OSRunning");
+    stateManager.toggleFuncStateFromPhyp(hostFunctions);
+}
+
 void getLcdDeviceData(std::string& lcdDevPath, uint8_t& lcdDevAddr,
                       std::string& lcdObjPath, const std::string& imValue)
 {
@@ -64,19 +96,44 @@ void getLcdDeviceData(std::string& lcdDevPath, uint8_t& lcdDevAddr,
     }
 }
 
-int main(int, char**)
+int main(int argc, char** argv)
 {
+    const auto startTime = std::chrono::steady_clock::now();
+
     try
     {
+        // Events handled by the app are recorded with "--record <file>", to
+        // be replayed with panel-replay. With "--emulate" no panel device is
+        // accessed, e.g. to benchmark the app on a private bus.
+        bool emulate = false;
+        for (int arg = 1; arg < argc; ++arg)
+        {
+            if (std::string(argv[arg]) == "--record" && (arg + 1) < argc)
+            {
+                panel::record::recorder().start(argv[++arg]);
+                Logger::log(Logger::Subsystem::APP, Logger::INFO,
+                            "Recording panel events to {}", argv[arg]);
+            }
+            else if (std::string(argv[arg]) == "--emulate")
+            {
+                emulate = true;
+                Logger::log(Logger::Subsystem::APP, Logger::INFO,
+                            "Emulating the panel");
+            }
+        }
+
         auto io = std::make_shared<boost::asio::io_context>();
         auto conn = std::make_shared<sdbusplus::asio::connection>(*io);
-        conn->request_name("com.ibm.PanelApp");
 
         auto server = sdbusplus::asio::object_server(conn);
 
         std::shared_ptr<sdbusplus::asio::dbus_interface> iface =
             server.add_interface("/com/ibm/panel_app", "com.ibm.panel");
 
+        // All the signal matches of the app are registered with the
+        // dispatcher.
+        auto dispatcher = std::make_shared<panel::SignalDispatcher>(conn);
+
         const std::string imValue = panel::utils::getSystemIM();
 
         std::string lcdDevPath{}, lcdObjPath{};
@@ -84,17 +141,49 @@ int main(int, char**)
         getLcdDeviceData(lcdDevPath, lcdDevAddr, lcdObjPath, imValue);
 
         // create transport lcd object
-        auto lcdPanel = std::make_shared<panel::Transport>(
-            lcdDevPath, lcdDevAddr, panel::types::PanelType::LCD, lcdObjPath);
+        auto lcdPanel = emulate ? std::make_shared<panel::Transport>()
+                                : std::make_shared<panel::Transport>(
+                                      lcdDevPath, lcdDevAddr,
+                                      panel::types::PanelType::LCD,
+                                      lcdObjPath);
 
         // create executor class
-        auto executor = std::make_shared<panel::Executor>(lcdPanel, iface, io);
+        auto executor =
+            std::make_shared<panel::Executor>(lcdPanel, conn, iface, io);
 
         // create state manager object
         auto stateManager =
             std::make_shared<panel::state::manager::PanelStateManager>(
                 lcdPanel, executor);
 
+        if (emulate)
+        {
+            executor->emulateHost();
+        }
+
+        // Restore the state kept across restarts of the app. The initial
+        // reads and signals reconcile it with the current system state.
+        // An emulated panel keeps its state in memory only, the files of the
+        // app serving the real panel are left alone.
+        std::optional<panel::types::FunctionNumber> restoredFunction;
+        auto& snapshotStore = panel::snapshot::store();
+        if (!emulate && snapshotStore.open(panel::constants::snapshotFilePath))
+        {
+            if (const auto snapshot = snapshotStore.load())
+            {
+                executor->restoreState(*snapshot);
+                stateManager->restoreState(*snapshot);
+                restoredFunction = snapshot->currentFunction;
+            }
+
+            snapshotStore.enableAutoSave(
+                io, [executor,
+                     stateManager](panel::snapshot::PanelState& state) {
+                    executor->saveState(state);
+                    stateManager->saveState(state);
+                });
+        }
+
         // create transport base object and listen for its presence to
         // enable CM on everest.
 
@@ -108,7 +197,7 @@ int main(int, char**)
         // create transport base object
         std::shared_ptr<panel::Transport> basePanel;
         std::unique_ptr<panel::PanelPresence> basePanelPresence;
-        if (baseDataMap.find(imValue) != baseDataMap.end())
+        if (!emulate && baseDataMap.find(imValue) != baseDataMap.end())
         {
             basePanel = std::make_shared<panel::Transport>(
                 std::get<0>((baseDataMap.find(imValue))->second),
@@ -127,7 +216,7 @@ int main(int, char**)
             if (baseObjPath == panel::constants::everBaseDbusObj)
             {
                 basePanelPresence = std::make_unique<panel::PanelPresence>(
-                    baseObjPath, conn, basePanel, stateManager);
+                    baseObjPath, dispatcher, basePanel, stateManager);
 
                 basePanelPresence->listenPanelPresence();
             }
@@ -138,11 +227,11 @@ int main(int, char**)
         // Listen to lcd panel presence always for both rainier and everest
         std::unique_ptr<panel::PanelPresence> presence;
 
-        if (panel::utils::lcdDataMap.find(imValue) !=
-            panel::utils::lcdDataMap.end())
+        if (!emulate && panel::utils::lcdDataMap.find(imValue) !=
+                             panel::utils::lcdDataMap.end())
         {
             presence = std::make_unique<panel::PanelPresence>(
-                lcdObjPath, conn, lcdPanel, stateManager);
+                lcdObjPath, dispatcher, lcdPanel, stateManager);
             presence->listenPanelPresence();
 
             /** Race condition can happen when the panel is removed exactly at
@@ -157,7 +246,8 @@ int main(int, char**)
         }
         else
         {
-            // set transport key to true for test system(tacoma).
+            // set transport key to true for test system(tacoma) and the
+            // emulated panel.
             lcdPanel->setTransportKey(true);
         }
 
@@ -167,37 +257,134 @@ int main(int, char**)
         std::unique_ptr<panel::ButtonHandler> btnHandler;
         try
         {
-            btnHandler = std::make_unique<panel::ButtonHandler>(
-                getInputDevicePath(imValue), io, lcdPanel, stateManager,
-                lcdDevPath);
+            // Buttons of the emulated panel are pressed over D-Bus only.
+            if (!emulate)
+            {
+                btnHandler = std::make_unique<panel::ButtonHandler>(
+                    getInputDevicePath(imValue), io, lcdPanel, stateManager,
+                    lcdDevPath);
+            }
         }
         catch (const std::runtime_error& e)
         {
-            std::cerr << e.what() << std::endl;
-            std::cerr << "Could not initialize button handler, panel buttons "
-                         "will not work!"
-                      << std::endl;
+            Logger::log(Logger::Subsystem::BUTTON, Logger::ERROR,
+                        "{}. Could not initialize button handler, panel "
+                        "buttons will not work!",
+                        e.what());
         }
 
-        panel::PELListener pelEvent(conn, stateManager, executor, lcdPanel);
-        pelEvent.listenPelEvents();
+        // The service is of Type=dbus, systemd considers it started once the
+        // bus name is acquired. Request the name only after the initial system
+        // state and PELs are loaded, i.e. once the panel is usable.
+        auto pendingLoads = std::make_shared<uint8_t>(2);
+        auto onLoaded = [conn, pendingLoads, startTime, stateManager,
+                         restoredFunction, emulate]() {
+            if (--(*pendingLoads) != 0)
+            {
+                return;
+            }
+
+            // No host is on the bus, its state read at start up is replaced.
+            if (emulate)
+            {
+                emulateHostRuntime(*stateManager);
+            }
+
+            // The function the panel was at is available only if the system
+            // state still enables it.
+            if (restoredFunction)
+            {
+                stateManager->moveToFunction(*restoredFunction);
+            }
+
+            conn->request_name("com.ibm.PanelApp");
+
+            Logger::log(
+                Logger::Subsystem::APP, Logger::INFO,
+                "Panel ready, time to first display = {} ms",
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - startTime)
+                    .count());
+        };
 
         // register property change call back for progress code.
-        panel::BootProgressCode progressCode(lcdPanel, conn, executor);
+        // Progress codes of the boot received before a restart of the app
+        // are kept in the timeline file.
+        if (!emulate)
+        {
+            panel::timeline::store().open(panel::constants::timelineFilePath);
+        }
+
+        panel::BootProgressCode progressCode(io, lcdPanel, dispatcher,
+                                             executor);
         progressCode.listenProgressCode();
 
+        panel::PELListener pelEvent(conn, dispatcher, stateManager, executor,
+                                    lcdPanel, progressCode);
+        pelEvent.listenPelEvents(onLoaded);
+
         panel::BusHandler busHandle(lcdPanel, iface, stateManager, executor);
 
+        iface->register_method("getSignalStatistics", [dispatcher]() {
+            return dispatcher->getStatistics();
+        });
+
         iface->initialize();
 
-        panel::SystemStatus systemStatus(conn, stateManager);
+        // Execution latency and outcome of the panel functions, read only.
+        std::shared_ptr<sdbusplus::asio::dbus_interface> telemetryIface =
+            server.add_interface("/com/ibm/panel_app",
+                                 "com.ibm.panel.Telemetry");
+        telemetryIface->register_method("getFunctionStatistics", [executor]() {
+            return executor->getTelemetry().getStatistics();
+        });
+        telemetryIface->register_method(
+            "getProgressCodeStatistics",
+            [&progressCode]() { return progressCode.getStatistics(); });
+        telemetryIface->initialize();
+
+        // Levels of the traces of each subsystem, e.g. "button" to "debug".
+        // Traces are kept in the log buffer, dumped with dumpLogs and
+        // decoded with paneltool.
+        std::shared_ptr<sdbusplus::asio::dbus_interface> loggingIface =
+            server.add_interface("/com/ibm/panel_app", "com.ibm.panel.Logging");
+        loggingIface->register_property(
+            "LogLevels", Logger::getLevels(),
+            [](const std::map<std::string, std::string>& request,
+               std::map<std::string, std::string>& levels) {
+                if (!Logger::setLevels(request))
+                {
+                    throw sdbusplus::xyz::openbmc_project::Common::Error::
+                        InvalidArgument();
+                }
+                levels = Logger::getLevels();
+                return 1;
+            });
+        // Returns the path of the dump, under the temporary directory for
+        // an emulated panel.
+        const std::string logDumpPath =
+            emulate ? (std::filesystem::temp_directory_path() / "panellog.bin")
+                          .string()
+                    : Logger::logDumpPath;
+        loggingIface->register_method("dumpLogs", [logDumpPath]() {
+            if (!Logger::dumpLogs(logDumpPath))
+            {
+                throw sdbusplus::xyz::openbmc_project::Common::Error::
+                    InternalFailure();
+            }
+            return logDumpPath;
+        });
+        loggingIface->initialize();
+
+        panel::SystemStatus systemStatus(conn, dispatcher, stateManager,
+                                         onLoaded);
 
         io->run();
     }
     catch (const std::exception& e)
     {
-        std::cerr << e.what();
-        std::cerr << "Panel app exiting..." << std::endl;
+        Logger::log(Logger::Subsystem::APP, Logger::CRITICAL,
+                    "{}. Panel app exiting...", e.what());
         return 0;
         // TODO: Need to rethrow here so that systemd can mark the service a
         // failure. We will do that once Everest hardware is ready.
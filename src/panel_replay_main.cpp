@@ -0,0 +1,439 @@
+#include "bus_handler.hpp"
+#include "bus_monitor.hpp"
+#include "button_handler.hpp"
+#include "event_recorder.hpp"
+#include "executor.hpp"
+#include "latency_summary.hpp"
+#include "panel_state_manager.hpp"
+#include "signal_dispatcher.hpp"
+#include "transport.hpp"
+
+#include <linux/input.h>
+#include <systemd/sd-bus.h>
+
+#include <boost/asio/spawn.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sdbusplus/asio/connection.hpp>
+#include <sdbusplus/asio/object_server.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Replays a recording made with "ibm-panel --record <file>" against an
+// emulated LCD panel and reports the processing latency of each event type.
+//
+// Usage: panel-replay <recording> [--speed <factor>]
+// A factor of 1 (default) replays at the recorded pace, 10 replays ten times
+// faster and 0 replays the events back to back.
+//
+// The replay runs on the session bus of the user, never on the system bus,
+// and the host is emulated. A recorded function that reboots the system,
+// changes the boot settings or creates a dump therefore fails instead of
+// reaching the services, and no PLDM request is sent to the host.
+
+namespace
+{
+using namespace panel;
+using Clock = std::chrono::steady_clock;
+
+/* Time given to the app timers to settle after the last event. */
+constexpr auto settleTime = std::chrono::seconds(1);
+
+/**
+ * @brief Api to connect to the session bus of the user.
+ * @param[in] io - Boost asio io_context.
+ * @return Connection to the session bus.
+ * @throw std::runtime_error if there is no session bus.
+ */
+std::shared_ptr<sdbusplus::asio::connection>
+    openSessionBus(boost::asio::io_context& io)
+{
+    sd_bus* bus = nullptr;
+    const auto rc = sd_bus_open_user(&bus);
+    if (rc < 0)
+    {
+        throw std::runtime_error(
+            std::string("Can't connect to the session bus: ") +
+            std::strerror(-rc));
+    }
+
+    // Connection takes its own reference of the bus.
+    auto conn = std::make_shared<sdbusplus::asio::connection>(io, bus);
+    sd_bus_unref(bus);
+    return conn;
+}
+
+/**
+ * @brief Feeds recorded events to the panel app objects.
+ */
+class Replay
+{
+  public:
+    Replay(const Replay&) = delete;
+    Replay& operator=(const Replay&) = delete;
+    Replay(Replay&&) = delete;
+    ~Replay() = default;
+
+    /**
+     * @brief Constructor.
+     * @param[in] io - Boost asio io_context object pointer.
+     * @param[in] events - Recorded events.
+     * @param[in] speed - Replay speed factor, 0 to replay back to back.
+     */
+    Replay(std::shared_ptr<boost::asio::io_context>& io,
+           std::vector<record::Event> events, const double speed) :
+        io(io),
+        conn(openSessionBus(*io)),
+        iface(std::make_shared<sdbusplus::asio::dbus_interface>(
+            conn, std::string{}, std::string{})),
+        dispatcher(std::make_shared<SignalDispatcher>(conn)),
+        transport(std::make_shared<Transport>()),
+        executor(std::make_shared<Executor>(transport, conn, iface, io)),
+        stateManager(std::make_shared<state::manager::PanelStateManager>(
+            transport, executor)),
+        buttonHandler(std::string{}, io, transport, stateManager,
+                      std::string{}),
+        busHandler(transport, iface, stateManager, executor),
+        progressCode(io, transport, dispatcher, executor),
+        pelListener(conn, dispatcher, stateManager, executor, transport,
+                    progressCode),
+        timer(*io),
+        events(std::move(events)), speed(speed)
+    {
+        // Recorded ExecuteFunction requests must not reach the host.
+        executor->emulateHost();
+    }
+
+    /**
+     * @brief Api to start feeding the events.
+     */
+    void start()
+    {
+        startTime = Clock::now();
+        scheduleNext();
+    }
+
+    /**
+     * @brief Api to print the latency of each event type.
+     */
+    void report() const
+    {
+        std::cout << std::left << std::setw(24) << "Event" << std::right
+                  << std::setw(8) << "Count" << std::setw(12) << "p50(us)"
+                  << std::setw(12) << "p99(us)" << std::setw(12) << "max(us)"
+                  << std::endl;
+
+        for (auto [type, samples] : latencies)
+        {
+            const auto summary = summarizeLatency(std::span(samples));
+            std::cout << std::left << std::setw(24) << record::toString(type)
+                      << std::right << std::setw(8) << summary.count
+                      << std::setw(12) << summary.p50 << std::setw(12)
+                      << summary.p99 << std::setw(12) << summary.max
+                      << std::endl;
+        }
+
+        std::cout << "Writes to the panel: "
+                  << transport->getEmulatedWriteCount() << std::endl;
+    }
+
+  private:
+    /**
+     * @brief Api to schedule the next event at its recorded time.
+     */
+    void scheduleNext()
+    {
+        if (next == events.size())
+        {
+            timer.expires_after(settleTime);
+            timer.async_wait([this](const boost::system::error_code&) {
+                io->stop();
+            });
+            return;
+        }
+
+        auto dueTime = Clock::now();
+        if (speed > 0)
+        {
+            dueTime = startTime +
+                      std::chrono::duration_cast<Clock::duration>(
+                          events[next].timestamp / speed);
+        }
+
+        // Events due now still go through the io context, so that the app
+        // timers expiring in between are run first.
+        timer.expires_at(dueTime);
+        timer.async_wait([this](const boost::system::error_code& ec) {
+            if (ec)
+            {
+                return;
+            }
+            dispatch(events[next++]);
+            scheduleNext();
+        });
+    }
+
+    /**
+     * @brief Api to feed an event to the app and measure its latency.
+     * @param[in] event - Recorded event.
+     */
+    void dispatch(record::Event& event)
+    {
+        const auto begin = Clock::now();
+        try
+        {
+            if (!process(event))
+            {
+                // Latency is measured once the method call completes.
+                return;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Replaying " << record::toString(event.type)
+                      << " failed. " << e.what() << std::endl;
+        }
+        latencies[event.type].push_back(Clock::now() - begin);
+    }
+
+    /**
+     * @brief Api to decode an event and call its handler.
+     * @param[in] event - Recorded event.
+     * @return false if the event completes asynchronously, true otherwise.
+     */
+    bool process(record::Event& event)
+    {
+        auto& payload = event.payload;
+
+        switch (event.type)
+        {
+            case record::EventType::BUTTON:
+            {
+                uint16_t count = 0;
+                payload >> count;
+
+                std::vector<input_event> inputEvents(count);
+                for (auto& inputEvent : inputEvents)
+                {
+                    inputEvent.type = EV_KEY;
+                    payload >> inputEvent.code >> inputEvent.value;
+                }
+                buttonHandler.processButtonEvents(inputEvents);
+                break;
+            }
+
+            case record::EventType::PANEL_PRESENCE:
+            {
+                bool present = false;
+                payload >> present;
+                transport->setTransportKey(present);
+                break;
+            }
+
+            case record::EventType::PEL_ADDED:
+            {
+                std::string objPath, resolution, eventId;
+                bool hasResolution = false, hasEventId = false;
+                payload >> objPath >> hasResolution >> resolution >>
+                    hasEventId >> eventId;
+                pelListener.processPelAdded(
+                    objPath,
+                    hasResolution ? std::optional(resolution) : std::nullopt,
+                    hasEventId ? std::optional(eventId) : std::nullopt);
+                break;
+            }
+
+            case record::EventType::PEL_REMOVED:
+            {
+                std::string objPath;
+                payload >> objPath;
+                pelListener.processPelRemoved(objPath);
+                break;
+            }
+
+            case record::EventType::PROGRESS_CODE:
+            {
+                uint64_t src = 0;
+                types::Binary hexWords;
+                payload >> src >> hexWords;
+                progressCode.processProgressCode({src, hexWords});
+                break;
+            }
+
+            case record::EventType::BMC_STATE:
+            {
+                std::string state;
+                payload >> state;
+                stateManager->updateBMCState(state);
+                break;
+            }
+
+            case record::EventType::POWER_STATE:
+            {
+                std::string state;
+                payload >> state;
+                stateManager->updatePowerState(state);
+                break;
+            }
+
+            case record::EventType::BOOT_PROGRESS:
+            {
+                std::string state;
+                payload >> state;
+                stateManager->updateBootProgressState(state);
+                break;
+            }
+
+            case record::EventType::OPERATING_MODE:
+            {
+                std::string mode;
+                payload >> mode;
+                stateManager->setSystemOperatingMode(mode);
+                break;
+            }
+
+            case record::EventType::DISPLAY:
+            {
+                std::string line1, line2;
+                payload >> line1 >> line2;
+                busHandler.display(line1, line2);
+                break;
+            }
+
+            case record::EventType::LAMP_TEST:
+            {
+                bool state = false;
+                payload >> state;
+                busHandler.triggerPanelLampTest(state);
+                break;
+            }
+
+            case record::EventType::TOGGLE_FUNCTION_STATE:
+            {
+                types::FunctionalityList list;
+                payload >> list;
+                busHandler.toggleFunctionState(list);
+                break;
+            }
+
+            case record::EventType::PROCESS_BUTTON:
+            {
+                int buttonEvent = 0;
+                payload >> buttonEvent;
+                busHandler.btnRequest(buttonEvent);
+                break;
+            }
+
+            case record::EventType::EXECUTE_FUNCTION:
+            {
+                types::FunctionNumber funcNum = 0;
+                payload >> funcNum;
+                boost::asio::spawn(
+                    *io, [this, funcNum, begin = Clock::now()](
+                             boost::asio::yield_context yield) {
+                        try
+                        {
+                            busHandler.triggerPanelFunc(funcNum, yield);
+                        }
+                        catch (const std::exception& e)
+                        {
+                            std::cerr << "ExecuteFunction " << int(funcNum)
+                                      << " failed. " << e.what() << std::endl;
+                        }
+                        latencies[record::EventType::EXECUTE_FUNCTION]
+                            .push_back(Clock::now() - begin);
+                    });
+                return false;
+            }
+
+            case record::EventType::GET_ENABLED_FUNCTIONS:
+                busHandler.getEnabledFunctionsList();
+                break;
+
+            case record::EventType::OS_IPL_MODE:
+            {
+                bool mode = false;
+                payload >> mode;
+                executor->setOSIPLMode(mode);
+                break;
+            }
+
+            default:
+                std::cerr << "Skipping unknown event type "
+                          << static_cast<int>(event.type) << std::endl;
+                break;
+        }
+        return true;
+    }
+
+    std::shared_ptr<boost::asio::io_context> io;
+    std::shared_ptr<sdbusplus::asio::connection> conn;
+    std::shared_ptr<sdbusplus::asio::dbus_interface> iface;
+    std::shared_ptr<SignalDispatcher> dispatcher;
+    std::shared_ptr<Transport> transport;
+    std::shared_ptr<Executor> executor;
+    std::shared_ptr<state::manager::PanelStateManager> stateManager;
+    ButtonHandler buttonHandler;
+    BusHandler busHandler;
+    BootProgressCode progressCode;
+    PELListener pelListener;
+
+    /* Timer firing at the recorded time of the next event */
+    boost::asio::steady_timer timer;
+
+    /* Recorded events */
+    std::vector<record::Event> events;
+
+    /* Index of the next event to replay */
+    size_t next = 0;
+
+    /* Replay speed factor */
+    const double speed;
+
+    /* Time the replay started */
+    Clock::time_point startTime;
+
+    /* Processing time of the events, per event type */
+    std::map<record::EventType, std::vector<Clock::duration>> latencies;
+};
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 2 && !(argc == 4 && std::string(argv[2]) == "--speed"))
+    {
+        std::cerr << "Usage: " << argv[0] << " <recording> [--speed <factor>]"
+                  << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        const double speed = (argc == 4) ? std::stod(argv[3]) : 1.0;
+        if (speed < 0)
+        {
+            throw std::invalid_argument("Speed factor can't be negative");
+        }
+
+        auto events = record::load(argv[1]);
+        std::cout << "Replaying " << events.size() << " events from "
+                  << argv[1] << std::endl;
+
+        auto io = std::make_shared<boost::asio::io_context>();
+        Replay replay(io, std::move(events), speed);
+        replay.start();
+        io->run();
+        replay.report();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -1,10 +1,14 @@
 #include "panel_state_manager.hpp"
 
+#include "bios_attributes.hpp"
 #include "const.hpp"
 #include "exception.hpp"
+#include "function_registry.hpp"
+#include "logger.hpp"
 #include "utils.hpp"
 
 #include <algorithm>
+#include <cstdlib>
 #include <xyz/openbmc_project/Common/error.hpp>
 
 namespace panel
@@ -13,6 +17,9 @@ namespace state
 {
 namespace manager
 {
+/* Subsystem the state manager logs as. */
+static constexpr auto logSubsystem = Logger::Subsystem::STATE;
+
 enum StateType
 {
     INITIAL_STATE = 0,
@@ -21,171 +28,37 @@ enum StateType
     INVALID_STATE = 127,
 };
 
-enum SystemStateMask : uint8_t
-{
-    NO_MASK = 0x00,
-    ENABLE_BY_PHYP = 0x01,
-    DISABLE_BY_PHYP = static_cast<SystemStateMask>(~ENABLE_BY_PHYP),
-    ENABLE_BMC_STANDBY_STATE = 0x20,
-    DISABLE_BMC_STANDBY_STATE =
-        static_cast<SystemStateMask>(~ENABLE_BMC_STANDBY_STATE),
-    ENABLE_POWER_STATE = 0x04,
-    DISABLE_POWER_STATE = static_cast<SystemStateMask>(~ENABLE_POWER_STATE),
-    ENABLE_PHYP_RUNTIME_STATE = 0x08,
-    DISABLE_PHYP_RUNTIME_STATE =
-        static_cast<SystemStateMask>(~ENABLE_PHYP_RUNTIME_STATE),
-    ENABLE_CE_MODE = 0x10,
-    DISABLE_CE_MODE = static_cast<SystemStateMask>(~ENABLE_CE_MODE),
-    ENABLE_MANUAL_MODE = 0x02,
-    DISABLE_MANUAL_MODE = static_cast<SystemStateMask>(~ENABLE_MANUAL_MODE),
-};
+using functions::Registry;
+using functions::SystemStateMask;
 
 static constexpr auto FUNCTION_02 = 2;
 static constexpr auto FUNCTION_63 = 63;
 static constexpr auto FUNCTION_64 = 64;
-
-// structure defines fincttionaliy attributes.
-struct FunctionalityAttributes
-{
-    types::FunctionNumber funcNumber;
-    // Any function number not dependent on the state of the machine or any
-    // other element will be enabled by default.
-    bool defaultEnabled;
-    bool isDebounceRequired;
-    std::string debounceSrcValue;
-    types::FunctionNumber subRangeEndPoint;
-
-    // This will hold the conditions to ebnable that method.
-    /* 0th bit - Enabled by Phyp.
-     * 1st bit - Operation mode Normal/Manual 0/1
-     * 2nd bit - Power on state Off/On 0/1
-     * 3rd bit - Is Runtime No/Yes 0/1
-     * 4th bit - CE No/Yes 0/1 - we need to discuss.
-     * 5th bit - At standby No/Yes 0/1 - BMC state not ready to ready.
-     */
-    types::FunctionMask enableMask;
-};
-
-// This can be moved to a common file in case this information needs to be
-// shared between files. List of functionalites, initialized to their
-// default values.
-std::vector<FunctionalityAttributes> functionalityList = {
-    {1, true, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {2, true, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {3, false, true, "A1008003", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_POWER_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE)},
-    {4, true, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {8, false, true, "A1008008", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_POWER_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE)},
-    {11, false, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {12, false, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {13, false, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {14, false, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {15, false, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {16, false, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {17, false, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {18, false, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {19, false, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {20, true, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::NO_MASK},
-    {21, false, false, "NONE", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_PHYP_RUNTIME_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_BY_PHYP)},
-    {22, false, true, "A1003022", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_PHYP_RUNTIME_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_BY_PHYP)},
-    {25, true, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::ENABLE_MANUAL_MODE},
-    {26, true, false, "NONE", StateType::INITIAL_STATE,
-     SystemStateMask::ENABLE_MANUAL_MODE},
-    {30, false, false, "NONE", 0x01,
-     (SystemStateMask::ENABLE_BMC_STANDBY_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE)},
-    {34, false, false, "NONE", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_PHYP_RUNTIME_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_BY_PHYP)},
-    {41, false, true, "A1003041", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_PHYP_RUNTIME_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_BY_PHYP)},
-    {42, false, true, "A1003042", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_PHYP_RUNTIME_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE)},
-    {43, true, true, "A1003043", StateType::INITIAL_STATE,
-     SystemStateMask::ENABLE_MANUAL_MODE},
-    {55, true, false, "NONE", 0x0D,
-     SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_CE_MODE},
-    {63, true, false, "NONE", 0x18,
-     SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_CE_MODE},
-    {64, true, false, "NONE", 0x18,
-     SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_CE_MODE},
-    {65, false, false, "NONE", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_PHYP_RUNTIME_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_BY_PHYP |
-      SystemStateMask::ENABLE_CE_MODE)},
-    {66, false, false, "NONE", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_PHYP_RUNTIME_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_BY_PHYP |
-      SystemStateMask::ENABLE_CE_MODE)},
-    {67, false, false, "NONE", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_PHYP_RUNTIME_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_BY_PHYP |
-      SystemStateMask::ENABLE_CE_MODE)},
-    {68, false, false, "NONE", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_PHYP_RUNTIME_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_BY_PHYP |
-      SystemStateMask::ENABLE_CE_MODE)},
-    {69, false, false, "NONE", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_PHYP_RUNTIME_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_BY_PHYP |
-      SystemStateMask::ENABLE_CE_MODE)},
-    {70, false, false, "NONE", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_PHYP_RUNTIME_STATE |
-      SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_BY_PHYP |
-      SystemStateMask::ENABLE_CE_MODE)},
-    {73, false, true, "A170800B", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_CE_MODE)},
-    {74, false, false, "NONE", StateType::INITIAL_STATE,
-     (SystemStateMask::ENABLE_MANUAL_MODE | SystemStateMask::ENABLE_CE_MODE)}};
+static constexpr types::FunctionMask allStateBits = 0xFF;
 
 void PanelStateManager::enableFunctonality(
     const types::FunctionalityList& listOfFunctionalities)
 {
     for (const auto& functionNumber : listOfFunctionalities)
     {
-        auto pos =
-            find_if(panelFunctions.begin(), panelFunctions.end(),
-                    [functionNumber](const PanelFunctionality& afunctionality) {
-                        return afunctionality.functionNumber == functionNumber;
-                    });
-        if (pos != panelFunctions.end())
+        const auto index = Registry::indexOf(functionNumber);
+        if (index != Registry::invalidIndex)
         {
+            auto pos = panelFunctions.begin() + index;
             // before enabling the function check if all the pre-conditions are
             // met.
             if ((pos->functionEnableMask == SystemStateMask::NO_MASK) ||
                 (systemState | pos->functionEnabledByPhyp) ==
                     pos->functionEnableMask)
             {
-                pos->functionActiveState = true;
+                enabledFunctions.set(functionNumber);
             }
         }
         else
         {
-            std::cout << "Entry for function Number " << functionNumber
-                      << " not found" << std::endl;
+            Logger::log(logSubsystem, Logger::ERROR,
+                        "Entry for function Number {} not found",
+                        functionNumber);
         }
     }
 }
@@ -195,25 +68,23 @@ void PanelStateManager::disableFunctonality(
 {
     for (const auto& functionNumber : listOfFunctionalities)
     {
-        auto pos =
-            find_if(panelFunctions.begin(), panelFunctions.end(),
-                    [functionNumber](const PanelFunctionality& afunctionality) {
-                        return afunctionality.functionNumber == functionNumber;
-                    });
-        if (pos != panelFunctions.end())
+        const auto index = Registry::indexOf(functionNumber);
+        if (index != Registry::invalidIndex)
         {
+            auto pos = panelFunctions.begin() + index;
             if ((pos->functionEnableMask == SystemStateMask::NO_MASK) ||
                 (systemState | pos->functionEnabledByPhyp) !=
                     pos->functionEnableMask)
 
             {
-                pos->functionActiveState = false;
+                enabledFunctions.reset(functionNumber);
             }
         }
         else
         {
-            std::cout << "Entry for functionality Number " << functionNumber
-                      << " not found" << std::endl;
+            Logger::log(logSubsystem, Logger::ERROR,
+                        "Entry for functionality Number {} not found",
+                        functionNumber);
         }
     }
 }
@@ -224,18 +95,21 @@ void PanelStateManager::toggleFuncStateFromPhyp(
     // List contain function(s) which has been set as enabled by phyp. Rest all
     // other functions whose "functionEnabledByPhyp" flag is set as enabled
     // should be reset to disabled.
-    for (auto& aFunction : panelFunctions)
+    functions::FunctionBitmap enabledByPhyp;
+    for (const auto funcNumber : list)
     {
-        auto pos = find_if(list.begin(), list.end(),
-                           [&aFunction](const types::FunctionNumber funNum) {
-                               return funNum == aFunction.functionNumber;
-                           });
+        if (funcNumber < functions::FunctionBitmap::capacity)
+        {
+            enabledByPhyp.set(funcNumber);
+        }
+    }
 
-        if (pos != list.end())
+    for (auto& aFunction : panelFunctions)
+    {
+        if (enabledByPhyp.test(aFunction.functionNumber))
         {
-            // then the cout can be used to test the function number.
-            std::cout << " Function enabled: " << (int)aFunction.functionNumber
-                      << std::endl;
+            Logger::log(logSubsystem, Logger::INFO, "Function enabled: {}",
+                        aFunction.functionNumber);
 
             aFunction.functionEnabledByPhyp = SystemStateMask::ENABLE_BY_PHYP;
         }
@@ -244,8 +118,8 @@ void PanelStateManager::toggleFuncStateFromPhyp(
             if (aFunction.functionEnabledByPhyp ==
                 SystemStateMask::ENABLE_BY_PHYP)
             {
-                std::cout << " Function Disabled: "
-                          << (int)aFunction.functionNumber << std::endl;
+                Logger::log(logSubsystem, Logger::INFO, "Function Disabled: {}",
+                            aFunction.functionNumber);
 
                 // If the function was enabled and not in the list it should be
                 // disabled.
@@ -254,30 +128,30 @@ void PanelStateManager::toggleFuncStateFromPhyp(
             }
         }
     }
-    updateFunctionStatus();
+    systemStateChanged(SystemStateMask::ENABLE_BY_PHYP);
 }
 
 void PanelStateManager::printPanelStates()
 {
     const PanelFunctionality& funcState = panelFunctions.at(panelCurState);
-    std::cout << "Selected functionality = " << int(funcState.functionNumber)
-              << std::endl;
+    Logger::log(logSubsystem, Logger::DEBUG, "Selected functionality = {}",
+                funcState.functionNumber);
 
     if (funcState.functionNumber == FUNCTION_02 && isSubrangeActive)
     {
-        std::cout << "Active sub state level 0 = "
-                  << functionality02[0].at(panelCurSubStates.at(0))
-                  << std::endl;
+        Logger::log(logSubsystem, Logger::DEBUG,
+                    "Active sub state level 0 = {}",
+                    functionality02[0].at(panelCurSubStates.at(0)));
         if (panelCurSubStates.at(1) != StateType::INVALID_STATE)
         {
-            std::cout << "Active sub state level 1 = "
-                      << functionality02[1].at(panelCurSubStates.at(1))
-                      << std::endl;
+            Logger::log(logSubsystem, Logger::DEBUG,
+                        "Active sub state level 1 = {}",
+                        functionality02[1].at(panelCurSubStates.at(1)));
             if (panelCurSubStates.at(2) != StateType::INVALID_STATE)
             {
-                std::cout << "Active sub state level 2 = "
-                          << functionality02[2].at(panelCurSubStates.at(2))
-                          << std::endl;
+                Logger::log(logSubsystem, Logger::DEBUG,
+                            "Active sub state level 2 = {}",
+                            functionality02[2].at(panelCurSubStates.at(2)));
             }
         }
     }
@@ -287,16 +161,19 @@ void PanelStateManager::printPanelStates()
         {
             if (panelCurSubStates.at(0) == StateType::INITIAL_STATE)
             {
-                std::cout << "Active sub state level 0 = INITIAL" << std::endl;
+                Logger::log(logSubsystem, Logger::DEBUG,
+                            "Active sub state level 0 = INITIAL");
             }
             else if (panelCurSubStates.at(0) == StateType::STAR_STATE)
             {
-                std::cout << "Active sub state level 0 = **" << std::endl;
+                Logger::log(logSubsystem, Logger::DEBUG,
+                            "Active sub state level 0 = **");
             }
             else
             {
-                std::cout << "Current active sub state level 0 = "
-                          << int(panelCurSubStates.at(0)) << std::endl;
+                Logger::log(logSubsystem, Logger::DEBUG,
+                            "Current active sub state level 0 = {}",
+                            panelCurSubStates.at(0));
             }
         }
     }
@@ -332,13 +209,62 @@ void PanelStateManager::processPanelButtonEvent(
             break;
     }
 
-    std::cout << "Button event " << (int)button << " At function - "
-              << (int)panelFunctions.at(panelCurState).functionNumber
-              << " Panel cur state = " << (int)systemState << std::endl;
+    Logger::log(Logger::Subsystem::BUTTON, Logger::DEBUG,
+                "Button event {} At function - {} Panel cur state = {}",
+                button, panelFunctions.at(panelCurState).functionNumber,
+                systemState);
+
+    snapshot::store().markDirty();
 
     // printPanelStates();
 }
 
+void PanelStateManager::processPanelNavigation(const int offset)
+{
+    if (offset == 0)
+    {
+        return;
+    }
+
+    // Any navigation takes the panel out of DEBOUCNE_SRC_STATE.
+    if (panelCurSubStates.at(0) == StateType::DEBOUCNE_SRC_STATE)
+    {
+        panelCurSubStates.at(0) = StateType::INITIAL_STATE;
+    }
+
+    // Only the state reached after all the steps is displayed.
+    isDisplayDeferred = true;
+    for (int step = 0; step < std::abs(offset); ++step)
+    {
+        if (offset > 0)
+        {
+            incrementState();
+        }
+        else
+        {
+            decrementState();
+        }
+    }
+    isDisplayDeferred = false;
+
+    if (panelFunctions.at(panelCurState).functionNumber == FUNCTION_02 &&
+        isSubrangeActive)
+    {
+        displayFunc02();
+    }
+    else
+    {
+        createDisplayString();
+    }
+
+    Logger::log(Logger::Subsystem::BUTTON, Logger::DEBUG,
+                "Navigation by {} At function - {} Panel cur state = {}",
+                offset, panelFunctions.at(panelCurState).functionNumber,
+                systemState);
+
+    snapshot::store().markDirty();
+}
+
 void PanelStateManager::resetStateManager()
 {
     panelCurState = StateType::INITIAL_STATE;
@@ -346,22 +272,29 @@ void PanelStateManager::resetStateManager()
     panelCurSubStates.push_back(StateType::INVALID_STATE);
     panelCurSubStates.push_back(StateType::INVALID_STATE);
     funcExecutor->executeFunction(01, types::FunctionalityList{});
+    snapshot::store().markDirty();
 }
 
 void PanelStateManager::initPanelState()
 {
-    for (const auto& singleFunctionality : functionalityList)
+    // Panel functions are kept in registry order, so a function is found at
+    // its registry index.
+    panelFunctions.reserve(Registry::table.size());
+    for (const auto& singleFunctionality : Registry::table)
     {
         PanelFunctionality aPanelFunctionality;
-        aPanelFunctionality.functionNumber = singleFunctionality.funcNumber;
-        aPanelFunctionality.functionActiveState =
-            singleFunctionality.defaultEnabled;
-        aPanelFunctionality.debouceSrc = singleFunctionality.debounceSrcValue;
+        aPanelFunctionality.functionNumber = singleFunctionality.number;
+        aPanelFunctionality.debounceSrc = singleFunctionality.debounceSrc;
         aPanelFunctionality.subFunctionUpperRange =
-            singleFunctionality.subRangeEndPoint;
+            singleFunctionality.subRangeEnd;
         aPanelFunctionality.functionEnableMask = singleFunctionality.enableMask;
 
         panelFunctions.push_back(aPanelFunctionality);
+
+        if (singleFunctionality.defaultEnabled)
+        {
+            enabledFunctions.set(singleFunctionality.number);
+        }
     }
 
     panelCurState = StateType::INITIAL_STATE;
@@ -381,16 +314,19 @@ void PanelStateManager::initFunction02()
 {
     try
     {
-        auto sysValues = utils::readSystemParameters();
+        auto& biosAttributes = bios::attributes();
+        const auto& iplType =
+            biosAttributes.get(bios::Attribute::OS_BOOT_TYPE);
+        const auto& systemOperatingMode =
+            biosAttributes.get(bios::Attribute::SYSTEM_OPERATING_MODE);
 
-        if (std::get<0>(sysValues).empty() || std::get<1>(sysValues).empty())
+        if (iplType.empty() || systemOperatingMode.empty())
         {
             throw std::runtime_error("Error reading system values");
         }
 
         utils::getNextBootSide(nextBootSideSelected);
 
-        const auto& iplType = std::get<0>(sysValues);
         if (iplType == "A_Mode")
         {
             panelCurSubStates.at(0) = 0;
@@ -410,10 +346,9 @@ void PanelStateManager::initFunction02()
         else
         {
             // TODO: Add elog here to detect invalid mode.
-            std::cout << "Invalid Mode" << std::endl;
+            Logger::log(logSubsystem, Logger::ERROR, "Invalid Mode");
         }
 
-        const auto& systemOperatingMode = std::get<1>(sysValues);
         if (systemOperatingMode == "Manual")
         {
             panelCurSubStates.at(1) = 0;
@@ -434,7 +369,7 @@ void PanelStateManager::initFunction02()
     }
     catch (const std::exception& e)
     {
-        std::cout << e.what() << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR, "{}", e.what());
         // TODO: Display FF once that commit is in.
     }
 }
@@ -514,29 +449,16 @@ void PanelStateManager::setIPLParameters(const types::ButtonEvent& button)
                 {
                     try
                     {
+                        // Operating mode is set once the job completes.
                         funcExecutor->executeFunction(
                             panelFunctions.at(panelCurState).functionNumber,
                             panelCurSubStates);
-
-                        if (panelCurSubStates.at(1) != StateType::INVALID_STATE)
-                        {
-                            if (panelCurSubStates.at(1) == 0)
-                            {
-                                std::cout << "Manual mode set" << std::endl;
-                                setSystemOperatingMode("Manual");
-                            }
-                            else if (panelCurSubStates.at(1) == 1)
-                            {
-                                std::cout << "Normal mode set" << std::endl;
-                                setSystemOperatingMode("Normal");
-                            }
-                        }
                     }
                     catch (const sdbusplus::exception::SdBusError& e)
                     {
-                        std::cerr << "Error writing values to set system "
-                                     "operating mode"
-                                  << std::endl;
+                        Logger::log(logSubsystem, Logger::ERROR,
+                                    "Error writing values to set system "
+                                    "operating mode");
                     }
 
                     // reset all the flag
@@ -553,7 +475,12 @@ void PanelStateManager::setIPLParameters(const types::ButtonEvent& button)
         default:
             break;
     }
-    displayFunc02();
+
+    // The in progress frame of a started job stays on top of the page.
+    if (!funcExecutor->isJobRunning(FUNCTION_02))
+    {
+        displayFunc02();
+    }
 }
 
 void PanelStateManager::incrementState()
@@ -591,30 +518,18 @@ void PanelStateManager::incrementState()
     }
     else
     {
-        auto it = next(panelFunctions.begin(), (panelCurState + 1));
-        for (; it != panelFunctions.end(); ++it)
+        // Move to the next enabled function, wrap around to the first one
+        // after the last.
+        const auto current = panelFunctions.at(panelCurState).functionNumber;
+        auto nextFunction = enabledFunctions.next(current);
+        if (!nextFunction)
         {
-            if (it->functionActiveState == true)
-            {
-                panelCurState = distance(panelFunctions.begin(), it);
-                break;
-            }
+            nextFunction = enabledFunctions.first();
         }
 
-        // when we reach past last entry after traversing
-        if (it == panelFunctions.end())
+        if (nextFunction)
         {
-            // reset the panelCurState
-            auto pos = find_if(panelFunctions.begin(), panelFunctions.end(),
-                               [](const PanelFunctionality& funcState) {
-                                   if (funcState.functionActiveState)
-                                   {
-                                       return true;
-                                   }
-                                   return false;
-                               });
-
-            panelCurState = distance(panelFunctions.begin(), pos);
+            panelCurState = Registry::indexOf(*nextFunction);
         }
     }
     createDisplayString();
@@ -653,38 +568,44 @@ void PanelStateManager::decrementState()
     }
     else
     {
-        auto it = prev(panelFunctions.rend(), panelCurState);
-
-        // decrement the panel current state till we get an enabled function
-        for (; it != panelFunctions.rend(); ++it)
+        // Move to the previous enabled function, wrap around to the last
+        // one before the first.
+        const auto current = panelFunctions.at(panelCurState).functionNumber;
+        auto prevFunction = enabledFunctions.prev(current);
+        if (!prevFunction)
         {
-            if (it->functionActiveState == true)
-            {
-                panelCurState = distance(it, (panelFunctions.rend() - 1));
-                break;
-            }
+            prevFunction = enabledFunctions.last();
         }
 
-        // when we reach to beginning while traversing
-        if (it == panelFunctions.rend())
+        if (prevFunction)
         {
-            // reset the panelCurState
-            auto nextpos =
-                find_if(panelFunctions.rbegin(), panelFunctions.rend(),
-                        [](const PanelFunctionality& funcState) {
-                            if (funcState.functionActiveState)
-                            {
-                                return true;
-                            }
-                            return false;
-                        });
-
-            panelCurState = distance(nextpos, (panelFunctions.rend() - 1));
+            panelCurState = Registry::indexOf(*prevFunction);
         }
     }
     createDisplayString();
 }
 
+void PanelStateManager::jobCompleted(
+    const types::FunctionNumber funcNumber,
+    const types::FunctionalityList& subFuncNumber, const bool success)
+{
+    if (!success || funcNumber != FUNCTION_02)
+    {
+        return;
+    }
+
+    if (subFuncNumber.at(1) == 0)
+    {
+        Logger::log(logSubsystem, Logger::INFO, "Manual mode set");
+        setSystemOperatingMode("Manual");
+    }
+    else if (subFuncNumber.at(1) == 1)
+    {
+        Logger::log(logSubsystem, Logger::INFO, "Normal mode set");
+        setSystemOperatingMode("Normal");
+    }
+}
+
 void PanelStateManager::executeState()
 {
     PanelFunctionality& funcState = panelFunctions.at(panelCurState);
@@ -695,7 +616,7 @@ void PanelStateManager::executeState()
         return;
     }
 
-    if (funcState.debouceSrc != "NONE" &&
+    if (!funcState.debounceSrc.empty() &&
         panelCurSubStates.at(0) != StateType::DEBOUCNE_SRC_STATE)
     {
         panelCurSubStates.at(0) = StateType::DEBOUCNE_SRC_STATE;
@@ -724,15 +645,16 @@ void PanelStateManager::executeState()
                 isSubrangeActive = false;
                 panelCurSubStates.at(0) = StateType::INITIAL_STATE;
                 createDisplayString();
-                std::cout << "Exit sub range, retain state at " << panelCurState
-                          << std::endl;
+                Logger::log(logSubsystem, Logger::DEBUG,
+                            "Exit sub range, retain state at {}",
+                            panelCurState);
             }
             else
             {
-                std::cout << "Subrange is already active, execute the sub "
-                             "functionality "
-                          << panelCurSubStates.at(0) << " of functionality"
-                          << panelCurState << std::endl;
+                Logger::log(logSubsystem, Logger::DEBUG,
+                            "Subrange is already active, execute the sub "
+                            "functionality {} of functionality {}",
+                            panelCurSubStates.at(0), panelCurState);
 
                 // after this execute do whatever is required to execute the
                 // functionality
@@ -781,10 +703,10 @@ void PanelStateManager::executeState()
             panelCurSubStates.at(0) = StateType::STAR_STATE;
             createDisplayString();
 
-            std::cout << "Sub Range has been activated, execute the sub "
-                         "functionality "
-                      << panelCurSubStates.at(0) << " of functionality"
-                      << panelCurState << std::endl;
+            Logger::log(logSubsystem, Logger::DEBUG,
+                        "Sub Range has been activated, execute the sub "
+                        "functionality {} of functionality {}",
+                        panelCurSubStates.at(0), panelCurState);
 
             // after this execute do whatever is required to execute the
             // functionality
@@ -814,6 +736,11 @@ void PanelStateManager::executeState()
 
 void PanelStateManager::createDisplayString() const
 {
+    if (isDisplayDeferred)
+    {
+        return;
+    }
+
     std::string line1{};
 
     const auto& funcState = panelFunctions.at(panelCurState);
@@ -838,7 +765,8 @@ void PanelStateManager::createDisplayString() const
         }
     }
 
-    utils::sendCurrDisplayToPanel(line1, std::string{}, transport);
+    funcExecutor->getRenderer().show(display::Layer::PAGE, line1,
+                                     std::string{});
 }
 
 void PanelStateManager::displayDebounce() const
@@ -857,7 +785,8 @@ void PanelStateManager::displayDebounce() const
         line2 = "SHUTDOWN SERVER?";
     }
 
-    utils::sendCurrDisplayToPanel(funcState.debouceSrc, line2, transport);
+    funcExecutor->getRenderer().show(display::Layer::PAGE,
+                                     std::string(funcState.debounceSrc), line2);
 }
 
 /**
@@ -866,6 +795,11 @@ _ _ _ _ __ __ __ __ T < _ _
 */
 void PanelStateManager::displayFunc02()
 {
+    if (isDisplayDeferred)
+    {
+        return;
+    }
+
     std::string line1(16, ' ');
     std::string line2(16, ' ');
 
@@ -906,26 +840,69 @@ void PanelStateManager::displayFunc02()
             line2.replace(13, 1, 1, '<');
         }
     }
-    utils::sendCurrDisplayToPanel(line1, line2, transport);
+    funcExecutor->getRenderer().show(display::Layer::PAGE, line1, line2);
 }
 
-void PanelStateManager::updateFunctionStatus()
+functions::FunctionBitmap
+    PanelStateManager::updateFunctionStatus(const types::FunctionMask stateBits)
 {
-    for (auto& aFunction : panelFunctions)
+    functions::FunctionBitmap changed;
+
+    // Only functions whose enable mask has one of the changed bits need to be
+    // evaluated. Functions enabled by default keep that state till the first
+    // update, which evaluates all of them.
+    const auto affected = Registry::dependentsOf(
+        isFunctionStatusEvaluated ? stateBits : allStateBits);
+    isFunctionStatusEvaluated = true;
+
+    for (auto funcNumber = affected.first(); funcNumber;
+         funcNumber = affected.next(*funcNumber))
     {
-        if (aFunction.functionEnableMask != 0x00)
+        const PanelFunctionality& aFunction =
+            panelFunctions.at(Registry::indexOf(*funcNumber));
+
+        const bool enable = ((systemState | aFunction.functionEnabledByPhyp) &
+                             aFunction.functionEnableMask) ==
+                            aFunction.functionEnableMask;
+
+        if (enable == enabledFunctions.test(*funcNumber))
         {
-            if (((systemState | aFunction.functionEnabledByPhyp) &
-                 aFunction.functionEnableMask) == aFunction.functionEnableMask)
-            {
-                aFunction.functionActiveState = true;
-            }
-            else
-            {
-                aFunction.functionActiveState = false;
-            }
+            continue;
         }
+
+        if (enable)
+        {
+            enabledFunctions.set(*funcNumber);
+        }
+        else
+        {
+            enabledFunctions.reset(*funcNumber);
+        }
+        changed.set(*funcNumber);
+    }
+    return changed;
+}
+
+void PanelStateManager::systemStateChanged(const types::FunctionMask stateBits)
+{
+    const auto changed = updateFunctionStatus(stateBits);
+
+    // Display needs a refresh only if the function the panel is at is no
+    // more available.
+    const auto current = panelFunctions.at(panelCurState).functionNumber;
+    if (changed.test(current) && !enabledFunctions.test(current))
+    {
+        Logger::log(logSubsystem, Logger::INFO,
+                    "Function {} disabled, moving panel to function 01",
+                    current);
+
+        panelCurState = StateType::INITIAL_STATE;
+        panelCurSubStates.at(0) = StateType::INITIAL_STATE;
+        isSubrangeActive = false;
+        createDisplayString();
     }
+
+    snapshot::store().markDirty();
 }
 
 void PanelStateManager::updateBMCState(const std::string& bmcState)
@@ -946,7 +923,7 @@ void PanelStateManager::updateBMCState(const std::string& bmcState)
             // set the bit.
             systemState =
                 systemState | SystemStateMask::ENABLE_BMC_STANDBY_STATE;
-            updateFunctionStatus();
+            systemStateChanged(SystemStateMask::ENABLE_BMC_STANDBY_STATE);
         }
     }
     // if the bit is already set and BMC state is NotReady
@@ -956,7 +933,7 @@ void PanelStateManager::updateBMCState(const std::string& bmcState)
     {
         // if the bit is set unset the bit
         systemState &= SystemStateMask::DISABLE_BMC_STANDBY_STATE;
-        updateFunctionStatus();
+        systemStateChanged(SystemStateMask::ENABLE_BMC_STANDBY_STATE);
     }
 }
 
@@ -971,7 +948,7 @@ void PanelStateManager::updatePowerState(const std::string& powerState)
             // set the bit.
             systemState |= SystemStateMask::ENABLE_POWER_STATE;
 
-            updateFunctionStatus();
+            systemStateChanged(SystemStateMask::ENABLE_POWER_STATE);
         }
     }
     // if the bit is already set and state is off
@@ -982,7 +959,7 @@ void PanelStateManager::updatePowerState(const std::string& powerState)
     {
         // unset the bit
         systemState &= SystemStateMask::DISABLE_POWER_STATE;
-        updateFunctionStatus();
+        systemStateChanged(SystemStateMask::ENABLE_POWER_STATE);
 
         // As this property is not updated while power off currently, we need to
         // update progress code at poweroff to ASCII 0 so that HMC can clear
@@ -1011,7 +988,8 @@ void PanelStateManager::updateBootProgressState(const std::string& bootState)
             // set the bit
             systemState |= SystemStateMask::ENABLE_PHYP_RUNTIME_STATE;
 
-            updateFunctionStatus();
+            funcExecutor->hostStateChanged();
+            systemStateChanged(SystemStateMask::ENABLE_PHYP_RUNTIME_STATE);
             return;
         }
     }
@@ -1020,7 +998,8 @@ void PanelStateManager::updateBootProgressState(const std::string& bootState)
     {
         // unset the bit
         systemState &= SystemStateMask::DISABLE_PHYP_RUNTIME_STATE;
-        updateFunctionStatus();
+        funcExecutor->hostStateChanged();
+        systemStateChanged(SystemStateMask::ENABLE_PHYP_RUNTIME_STATE);
     }
 }
 
@@ -1033,14 +1012,14 @@ void PanelStateManager::setSystemOperatingMode(const std::string& operatingMode)
         {
             // set the bit
             systemState |= SystemStateMask::ENABLE_MANUAL_MODE;
-            updateFunctionStatus();
+            systemStateChanged(SystemStateMask::ENABLE_MANUAL_MODE);
         }
     }
     // check if the bit is already unset
     else if ((systemState & SystemStateMask::ENABLE_MANUAL_MODE) != 0x00)
     {
         systemState &= SystemStateMask::DISABLE_MANUAL_MODE;
-        updateFunctionStatus();
+        systemStateChanged(SystemStateMask::ENABLE_MANUAL_MODE);
     }
 }
 
@@ -1053,7 +1032,7 @@ void PanelStateManager::setCEState()
     if ((systemState & SystemStateMask::ENABLE_CE_MODE))
     {
         systemState &= SystemStateMask::DISABLE_CE_MODE;
-        updateFunctionStatus();
+        systemStateChanged(SystemStateMask::ENABLE_CE_MODE);
 
         // When CE mode is disabled, reset the state.
         funcExecutor->executeFunction(
@@ -1070,7 +1049,7 @@ void PanelStateManager::setCEState()
             {
                 // set CE mode
                 systemState |= SystemStateMask::ENABLE_CE_MODE;
-                updateFunctionStatus();
+                systemStateChanged(SystemStateMask::ENABLE_CE_MODE);
 
                 // call to executor is required to reset the state.
                 funcExecutor->executeFunction(
@@ -1080,8 +1059,8 @@ void PanelStateManager::setCEState()
             else
             {
                 // If this is subsequent call to function 25 just show 00.
-                utils::sendCurrDisplayToPanel("25    00", std::string{},
-                                              transport);
+                funcExecutor->getRenderer().show(display::Layer::OVERLAY,
+                                                 "25    00", std::string{});
             }
         }
         else
@@ -1098,29 +1077,22 @@ void PanelStateManager::setCEState()
 
 bool PanelStateManager::isFunctionSupported(const types::FunctionNumber funcNum)
 {
-    types::FunctionalityList supportedFuncs = {21, 22, 34, 65, 66,
-                                               67, 68, 69, 70};
-
-    if (find(supportedFuncs.begin(), supportedFuncs.end(), funcNum) !=
-        supportedFuncs.end())
-    {
-        return true;
-    }
-    return false;
+    const auto function = Registry::find(funcNum);
+    return (function != nullptr) && function->remoteCapable;
 }
 
 bool PanelStateManager::isRemoteAccessEnabled(
     const types::FunctionNumber funcNum)
 {
-    auto pos = find_if(panelFunctions.begin(), panelFunctions.end(),
-                       [funcNum](const PanelFunctionality& afunctionality) {
-                           return afunctionality.functionNumber == funcNum;
-                       });
-    if (pos != panelFunctions.end())
+    const auto index = Registry::indexOf(funcNum);
+    if (index != Registry::invalidIndex)
     {
+        const auto& function = panelFunctions.at(index);
+
         // if the function is enabled by PHYP and system at PHYP runtime.
         return (
-            (pos->functionEnabledByPhyp == SystemStateMask::ENABLE_BY_PHYP) &&
+            (function.functionEnabledByPhyp ==
+             SystemStateMask::ENABLE_BY_PHYP) &&
             ((systemState & SystemStateMask::ENABLE_PHYP_RUNTIME_STATE) ==
              SystemStateMask::ENABLE_PHYP_RUNTIME_STATE));
     }
@@ -1129,34 +1101,63 @@ bool PanelStateManager::isRemoteAccessEnabled(
 }
 
 types::ReturnStatus PanelStateManager::triggerFunctionDirectly(
-    const types::FunctionNumber funcNum)
+    const types::FunctionNumber funcNum, boost::asio::yield_context yield)
 {
     if (isFunctionSupported(funcNum) && isRemoteAccessEnabled(funcNum))
     {
-        return (funcExecutor->executeFunctionDirectly(funcNum));
+        return (funcExecutor->executeFunctionDirectly(funcNum, yield));
     }
 
-    std::cerr << "Function " << static_cast<int>(funcNum) << " is disabled."
-              << std::endl;
+    Logger::log(logSubsystem, Logger::ERROR, "Function {} is disabled.",
+                funcNum);
     throw sdbusplus::xyz::openbmc_project::Common::Error::NotAllowed();
 }
 
 types::Binary PanelStateManager::getEnabledFunctionsList()
 {
-    types::Binary inputFunctions = {21, 22, 34, 65, 66, 67, 68, 69, 70};
-
     types::Binary enabledFunctions;
-    enabledFunctions.reserve(inputFunctions.size());
 
-    for (auto& val : inputFunctions)
+    for (const auto& function : Registry::table)
     {
-        if (isRemoteAccessEnabled(val))
+        if (function.remoteCapable && isRemoteAccessEnabled(function.number))
         {
-            enabledFunctions.push_back(val);
+            enabledFunctions.push_back(function.number);
         }
     }
     return enabledFunctions;
 }
+
+void PanelStateManager::saveState(snapshot::PanelState& state) const
+{
+    state.systemState = systemState & (SystemStateMask::ENABLE_CE_MODE |
+                                       SystemStateMask::ENABLE_MANUAL_MODE);
+    state.currentFunction = panelFunctions.at(panelCurState).functionNumber;
+}
+
+void PanelStateManager::restoreState(const snapshot::PanelState& state)
+{
+    const types::FunctionMask restoredBits =
+        SystemStateMask::ENABLE_CE_MODE | SystemStateMask::ENABLE_MANUAL_MODE;
+
+    systemState = (systemState & ~restoredBits) |
+                  (state.systemState & restoredBits);
+    systemStateChanged(restoredBits);
+}
+
+bool PanelStateManager::moveToFunction(const types::FunctionNumber funcNumber)
+{
+    if (!enabledFunctions.test(funcNumber))
+    {
+        return false;
+    }
+
+    panelCurState = Registry::indexOf(funcNumber);
+    panelCurSubStates.at(0) = StateType::INITIAL_STATE;
+    isSubrangeActive = false;
+    createDisplayString();
+    return true;
+}
+
 } // namespace manager
 } // namespace state
 } // namespace panel
@@ -1,6 +1,7 @@
 #include "pldm_fw.hpp"
 
 #include "exception.hpp"
+#include "logger.hpp"
 #include "utils.hpp"
 
 #include <libpldm/entity.h>
@@ -8,102 +9,138 @@
 #include <libpldm/pldm.h>
 #include <libpldm/state_set.h>
 
-#include <iostream>
+#include <boost/asio/post.hpp>
 #include <sdbusplus/asio/connection.hpp>
 #include <sdbusplus/asio/object_server.hpp>
 
 namespace panel
 {
-types::Byte PldmFramework::getInstanceID()
+namespace
 {
-    types::Byte instanceId = 0;
-    auto bus = sdbusplus::bus::new_default();
+constexpr auto logSubsystem = Logger::Subsystem::PLDM;
+} // namespace
 
-    try
+bool PldmFramework::openPldmSocket()
+{
+    if (pldmSocket.is_open())
     {
-        auto method = bus.new_method_call(
-            "xyz.openbmc_project.PLDM", "/xyz/openbmc_project/pldm",
-            "xyz.openbmc_project.PLDM.Requester", "GetInstanceId");
-        method.append(mctpEid);
-        auto reply = bus.call(method);
-        reply.read(instanceId);
+        return true;
     }
-    catch (const sdbusplus::exception::SdBusError& e)
+
+    int fd = pldm_open();
+    if (fd == -1)
     {
-        std::cerr << e.what() << std::endl;
-        throw FunctionFailure("pldm: call to GetInstanceId failed.");
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "pldm_open() failed with error = {}", strerror(errno));
+        std::map<std::string, std::string> additionalData{};
+        additionalData.emplace("DESCRIPTION",
+                               "pldm: Failed to connect to MCTP socket");
+        additionalData.emplace("ERRNO:", strerror(errno));
+        utils::createPEL("com.ibm.Panel.Error.HostCommunicationError",
+                         "xyz.openbmc_project.Logging.Entry.Level.Warning",
+                         additionalData);
+        return false;
     }
-    return instanceId;
+
+    pldmSocket.assign(fd);
+    return true;
 }
 
-void PldmFramework::fetchPanelEffecterStateSet(const types::PdrList& pdrs,
-                                               uint16_t& effecterId,
-                                               types::Byte& effecterCount,
-                                               types::Byte& panelEffecterPos)
+void PldmFramework::closePldmSocket()
+{
+    boost::system::error_code ec;
+    pldmSocket.close(ec);
+    if (ec)
+    {
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Close on File descriptor failed with error = {}",
+                    ec.message());
+    }
+}
+
+PldmFramework::PanelEffecter
+    PldmFramework::fetchPanelEffecterStateSet(const types::PdrList& pdrs)
 {
     auto pdr =
         reinterpret_cast<const pldm_state_effecter_pdr*>(pdrs.front().data());
 
-    auto possibleStates =
-        reinterpret_cast<const state_effecter_possible_states*>(
-            pdr->possible_states);
+    // Possible states of the composite effecters are packed one after the
+    // other, each entry is sized by its own possible_states_size.
+    auto possibleStatesPtr = pdr->possible_states;
 
-    for (auto offset = 0; offset < pdr->composite_effecter_count; offset++)
+    for (types::Byte offset = 0; offset < pdr->composite_effecter_count;
+         offset++)
     {
+        auto possibleStates =
+            reinterpret_cast<const state_effecter_possible_states*>(
+                possibleStatesPtr);
+
         if (possibleStates->state_set_id == stateIdToEnablePanelFunc)
         {
-            effecterId = pdr->effecter_id;
-            effecterCount = pdr->composite_effecter_count;
-            panelEffecterPos = offset;
-            return;
+            return {pdr->effecter_id, pdr->composite_effecter_count, offset};
         }
+
+        possibleStatesPtr += sizeof(possibleStates->state_set_id) +
+                             sizeof(possibleStates->possible_states_size) +
+                             possibleStates->possible_states_size;
     }
 
     throw FunctionFailure(
         "State set ID to enable panel function could not be found in PDR.");
 }
 
+std::optional<PldmFramework::PanelEffecter> PldmFramework::getPanelEffecter()
+{
+    if (panelEffecter)
+    {
+        return panelEffecter;
+    }
+
+    types::PdrList pdrs =
+        utils::getPDR(phypTerminusID, frontPanelBoardEntityId,
+                      stateIdToEnablePanelFunc, "FindStateEffecterPDR");
+
+    if (pdrs.empty())
+    {
+        std::map<std::string, std::string> additionalData{};
+        additionalData.emplace("DESCRIPTION",
+                               "Empty PDR returned for panel entity id.");
+        utils::createPEL("com.ibm.Panel.Error.HostCommunicationError",
+                         "xyz.openbmc_project.Logging.Entry.Level.Warning",
+                         additionalData);
+        return std::nullopt;
+    }
+
+    panelEffecter = fetchPanelEffecterStateSet(pdrs);
+    return panelEffecter;
+}
+
 types::PldmPacket
-    PldmFramework::prepareSetEffecterReq(const types::PdrList& pdrs,
+    PldmFramework::prepareSetEffecterReq(const PanelEffecter& effecter,
                                          types::Byte instanceId,
                                          const types::FunctionNumber& function)
 {
-    types::Byte effecterCount = 0;
-    types::Byte panelEffecterPos = 0;
-    uint16_t effecterId = 0;
-
-    fetchPanelEffecterStateSet(pdrs, effecterId, effecterCount,
-                               panelEffecterPos);
-
     types::PldmPacket request(
-        sizeof(pldm_msg_hdr) + sizeof(effecterId) + sizeof(effecterCount) +
-        (effecterCount * sizeof(set_effecter_state_field)));
+        sizeof(pldm_msg_hdr) + sizeof(effecter.effecterId) +
+        sizeof(effecter.effecterCount) +
+        (effecter.effecterCount * sizeof(set_effecter_state_field)));
 
     auto requestMsg = reinterpret_cast<pldm_msg*>(request.data());
 
-    std::vector<set_effecter_state_field> stateField;
-
-    for (types::Byte pos = 0; panelEffecterPos <= effecterCount; pos++)
-    {
-        if (pos == panelEffecterPos)
-        {
-            stateField.emplace_back(
-                set_effecter_state_field{PLDM_REQUEST_SET, function});
-            break;
-        }
-        else
-        {
-            stateField.emplace_back(
-                set_effecter_state_field{PLDM_NO_CHANGE, 0});
-        }
-    }
+    // Only the panel function effecter is set, rest of the composite effecters
+    // are left unchanged.
+    std::vector<set_effecter_state_field> stateField(
+        effecter.effecterCount, set_effecter_state_field{PLDM_NO_CHANGE, 0});
+    stateField[effecter.panelEffecterPos] =
+        set_effecter_state_field{PLDM_REQUEST_SET, function};
 
     int rc = encode_set_state_effecter_states_req(
-        instanceId, effecterId, effecterCount, stateField.data(), requestMsg);
+        instanceId, effecter.effecterId, effecter.effecterCount,
+        stateField.data(), requestMsg);
 
     if (rc != PLDM_SUCCESS)
     {
-        std::cerr << "Return code = " << rc << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR, "Return code = {}", rc);
         throw FunctionFailure(
             "pldm: encode set effecter states request returned error.");
     }
@@ -111,72 +148,143 @@ types::PldmPacket
 }
 
 void PldmFramework::sendPanelFunctionToPhyp(
-    const types::FunctionNumber& funcNumber)
+    const types::FunctionNumber& funcNumber, ResponseHandler handler)
 {
-    types::PdrList pdrs =
-        utils::getPDR(phypTerminusID, frontPanelBoardEntityId,
-                      stateIdToEnablePanelFunc, "FindStateEffecterPDR");
+    requests.push_back(Request{funcNumber, std::move(handler)});
+    processNextRequest();
+}
 
-    if (pdrs.empty())
+void PldmFramework::processNextRequest()
+{
+    if (awaitingResponse || requests.empty())
     {
-        std::map<std::string, std::string> additionalData{};
-        additionalData.emplace("DESCRIPTION",
-                               "Empty PDR returned for panel entity id.");
-        utils::createPEL("com.ibm.Panel.Error.HostCommunicationError",
-                         "xyz.openbmc_project.Logging.Entry.Level.Warning",
-                         additionalData);
         return;
     }
 
-    types::Byte instance = getInstanceID();
+    if (isHostEmulated)
+    {
+        completeRequest(true);
+        return;
+    }
 
-    types::PldmPacket packet =
-        prepareSetEffecterReq(pdrs, instance, funcNumber);
+    const auto funcNumber = requests.front().funcNumber;
+    std::optional<PanelEffecter> effecter;
 
-    if (packet.empty())
+    try
     {
-        std::map<std::string, std::string> additionalData{};
-        additionalData.emplace(
-            "DESCRIPTION", "pldm:SetStateEffecterStates request message empty");
-        utils::createPEL("com.ibm.Panel.Error.HostCommunicationError",
-                         "xyz.openbmc_project.Logging.Entry.Level.Warning",
-                         additionalData);
+        effecter = getPanelEffecter();
+    }
+    catch (const std::exception& e)
+    {
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Function {} request failed. {}", funcNumber, e.what());
+    }
+
+    if (!effecter)
+    {
+        completeRequest(false);
         return;
     }
 
-    int fd = pldm_open();
-    if (fd == -1)
+    awaitingResponse = true;
+    const auto sequence = ++requestSequence;
+
+    // Deadline covers pldmd handing out the instance id as well, so that a
+    // hung pldmd can't hold the queue.
+    responseTimer.expires_after(responseTimeout);
+    responseTimer.async_wait(
+        [this, sequence, funcNumber](const boost::system::error_code& ec) {
+            if (ec || !awaitingResponse || sequence != requestSequence)
+            {
+                return;
+            }
+
+            Logger::log(logSubsystem, Logger::ERROR,
+                        "pldm: No response for function {}", funcNumber);
+            std::map<std::string, std::string> additionalData{};
+            additionalData.emplace("DESCRIPTION",
+                                   "pldm: Panel function request timed out.");
+            utils::createPEL("com.ibm.Panel.Error.HostCommunicationError",
+                             "xyz.openbmc_project.Logging.Entry.Level.Warning",
+                             additionalData);
+
+            boost::system::error_code cancelEc;
+            pldmSocket.cancel(cancelEc);
+            completeRequest(false);
+        });
+
+    conn->async_method_call(
+        [this, sequence, effecter = *effecter,
+         funcNumber](const boost::system::error_code& ec,
+                     const types::Byte instanceId) {
+            if (!awaitingResponse || sequence != requestSequence)
+            {
+                return;
+            }
+
+            if (ec)
+            {
+                Logger::log(logSubsystem, Logger::ERROR,
+                            "pldm: call to GetInstanceId failed. {}",
+                            ec.message());
+                completeRequest(false);
+                return;
+            }
+
+            currentInstanceId = instanceId;
+            sendRequest(effecter, funcNumber);
+        },
+        "xyz.openbmc_project.PLDM", "/xyz/openbmc_project/pldm",
+        "xyz.openbmc_project.PLDM.Requester", "GetInstanceId", mctpEid);
+}
+
+void PldmFramework::sendRequest(const PanelEffecter& effecter,
+                                const types::FunctionNumber funcNumber)
+{
+    types::PldmPacket packet;
+
+    try
+    {
+        packet = prepareSetEffecterReq(effecter, currentInstanceId, funcNumber);
+    }
+    catch (const std::exception& e)
+    {
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Function {} request failed. {}", funcNumber, e.what());
+        completeRequest(false);
+        return;
+    }
+
+    if (packet.empty())
     {
-        std::cerr << "pldm_open() failed with error = " << strerror(errno)
-                  << std::endl;
         std::map<std::string, std::string> additionalData{};
-        additionalData.emplace("DESCRIPTION",
-                               "pldm: Failed to connect to MCTP socket");
-        additionalData.emplace("ERRNO:", strerror(errno));
+        additionalData.emplace(
+            "DESCRIPTION", "pldm:SetStateEffecterStates request message empty");
         utils::createPEL("com.ibm.Panel.Error.HostCommunicationError",
                          "xyz.openbmc_project.Logging.Entry.Level.Warning",
                          additionalData);
+        completeRequest(false);
         return;
     }
 
-    std::cout << "packet data sent to pldm: ";
-    for (const auto i : packet)
+    if (!openPldmSocket())
     {
-        std::cout << std::setfill('0') << std::setw(2) << std::hex << (int)i
-                  << " ";
+        completeRequest(false);
+        return;
     }
-    std::cout << std::endl;
 
-    auto rc = pldm_send(mctpEid, fd, packet.data(), packet.size());
+    Logger::log(logSubsystem, Logger::DEBUG, "packet data sent to pldm: {}",
+                Logger::Bytes{packet});
 
-    if (close(fd) == -1)
-    {
-        std::cerr << "Close on File descriptor failed with error = "
-                  << strerror(errno) << std::endl;
-    }
+    auto rc = pldm_send(mctpEid, pldmSocket.native_handle(), packet.data(),
+                        packet.size());
 
     if (rc)
     {
+        // Socket could have gone stale, say on a restart of mctp demux
+        // daemon. Reopen it on the next request.
+        closePldmSocket();
+
         std::map<std::string, std::string> additionalData{};
         additionalData.emplace(
             "DESCRIPTION",
@@ -184,6 +292,91 @@ void PldmFramework::sendPanelFunctionToPhyp(
         panel::utils::createPEL(
             "com.ibm.Panel.Error.HostCommunicationError",
             "xyz.openbmc_project.Logging.Entry.Level.Warning", additionalData);
+        completeRequest(false);
+        return;
     }
+
+    waitForResponse();
+}
+
+void PldmFramework::waitForResponse()
+{
+    const auto sequence = requestSequence;
+
+    pldmSocket.async_wait(
+        boost::asio::posix::stream_descriptor::wait_read,
+        [this, sequence](const boost::system::error_code& ec) {
+            if (ec || !awaitingResponse || sequence != requestSequence)
+            {
+                return;
+            }
+
+            uint8_t* response = nullptr;
+            size_t responseLength = 0;
+
+            auto rc = pldm_recv(mctpEid, pldmSocket.native_handle(),
+                                currentInstanceId, &response, &responseLength);
+
+            if (rc == PLDM_REQUESTER_NOT_PLDM_MSG ||
+                rc == PLDM_REQUESTER_NOT_RESP_MSG ||
+                rc == PLDM_REQUESTER_INSTANCE_ID_MISMATCH)
+            {
+                // Socket carries every PLDM message of the endpoint, wait for
+                // the one meant for this request.
+                waitForResponse();
+                return;
+            }
+
+            if (rc != PLDM_REQUESTER_SUCCESS)
+            {
+                Logger::log(logSubsystem, Logger::ERROR,
+                            "pldm_recv failed with rc = {}", rc);
+                closePldmSocket();
+                completeRequest(false);
+                return;
+            }
+
+            std::unique_ptr<uint8_t, decltype(&free)> responsePtr(response,
+                                                                   &free);
+            uint8_t completionCode = PLDM_ERROR;
+
+            rc = decode_set_state_effecter_states_resp(
+                reinterpret_cast<pldm_msg*>(response),
+                responseLength - sizeof(pldm_msg_hdr), &completionCode);
+
+            if (rc != PLDM_SUCCESS || completionCode != PLDM_SUCCESS)
+            {
+                Logger::log(logSubsystem, Logger::ERROR,
+                            "SetStateEffecterStates failed. rc = {}, "
+                            "completion code = {}",
+                            rc, completionCode);
+                completeRequest(false);
+                return;
+            }
+
+            completeRequest(true);
+        });
+}
+
+void PldmFramework::completeRequest(bool status)
+{
+    if (requests.empty())
+    {
+        return;
+    }
+
+    auto handler = std::move(requests.front().handler);
+    requests.pop_front();
+
+    awaitingResponse = false;
+    responseTimer.cancel();
+
+    if (handler)
+    {
+        boost::asio::post(*io_context, [handler = std::move(handler),
+                                        status]() { handler(status); });
+    }
+
+    processNextRequest();
 }
 } // namespace panel
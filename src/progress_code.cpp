@@ -0,0 +1,39 @@
+#include "progress_code.hpp"
+
+#include <algorithm>
+
+namespace panel
+{
+namespace progress_code
+{
+SrcRecord decodeSrc(const uint64_t src)
+{
+    SrcRecord record;
+    for (size_t pos = 0; pos < record.src.size(); ++pos)
+    {
+        record.src[pos] = static_cast<char>((src >> (8 * pos)) & 0xFF);
+    }
+    return record;
+}
+
+void decodeHexWords(std::span<const types::Byte> hexWordData,
+                    SrcRecord& record)
+{
+    // 4th byte is the number of valid words, the first of which is the SRC
+    // itself.
+    const size_t validWords = hexWordData[3];
+    const size_t count = std::min({validWords > 1 ? validWords - 1 : 0,
+                                   SrcRecord::maxHexWords,
+                                   (hexWordData.size() - hexWordOffset) / 4});
+
+    for (size_t word = 0; word < count; ++word)
+    {
+        const auto* bytes = &hexWordData[hexWordOffset + 4 * word];
+        record.hexWords[word] = (uint32_t{bytes[0]} << 24) |
+                                (uint32_t{bytes[1]} << 16) |
+                                (uint32_t{bytes[2]} << 8) | uint32_t{bytes[3]};
+    }
+    record.hexWordCount = static_cast<uint8_t>(count);
+}
+} // namespace progress_code
+} // namespace panel
@@ -0,0 +1,217 @@
+#include "progress_timeline.hpp"
+
+#include "logger.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace panel
+{
+namespace timeline
+{
+namespace
+{
+/* Identifies a timeline file. */
+constexpr std::array<char, 8> magic{'P', 'N', 'L', 'T', 'I', 'M', 'E', '\0'};
+
+/* Version of the timeline layout, bumped on any change of the layout. */
+constexpr uint32_t version = 1;
+
+/* Boot id of the kernel, changes on every boot of the BMC. */
+constexpr auto bootIdPath = "/proc/sys/kernel/random/boot_id";
+
+/* Length of a boot id, a UUID in text form. */
+constexpr std::streamsize bootIdLength = 36;
+} // namespace
+
+const BootId& bmcBootId()
+{
+    static const BootId bootId = []() {
+        BootId id{};
+        std::ifstream file(bootIdPath);
+        if (!file.read(id.data(), bootIdLength))
+        {
+            Logger::log(Logger::Subsystem::EVENTS, Logger::ERROR,
+                        "Failed to read BMC boot id from {}", bootIdPath);
+            return BootId{};
+        }
+        return id;
+    }();
+    return bootId;
+}
+
+static_assert(sizeof(Entry) == 56, "Timeline entry layout changed.");
+
+SrcRecord Entry::toSrcRecord() const
+{
+    SrcRecord srcRecord;
+    srcRecord.src = src;
+    srcRecord.hexWords = hexWords;
+    srcRecord.hexWordCount = hexWordCount;
+    return srcRecord;
+}
+
+Timeline::Timeline()
+{
+    void* address = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (address == MAP_FAILED)
+    {
+        throw std::runtime_error("Failed to map progress code timeline");
+    }
+    header = static_cast<Header*>(address);
+    entries = reinterpret_cast<Entry*>(header + 1);
+    reset();
+}
+
+Timeline::~Timeline()
+{
+    munmap(header, mapSize);
+    if (fd != -1)
+    {
+        close(fd);
+    }
+}
+
+void Timeline::reset()
+{
+    *header = Header{magic, version, capacity, 1, 0, 0, {}};
+}
+
+bool Timeline::open(const std::string& path, const bool readOnly)
+{
+    if (!readOnly)
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(
+            std::filesystem::path(path).parent_path(), ec);
+    }
+
+    const int flags = readOnly ? O_RDONLY : (O_RDWR | O_CREAT);
+    const int fileFd = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+    if (fileFd == -1)
+    {
+        Logger::log(Logger::Subsystem::EVENTS, Logger::ERROR,
+                    "Failed to open timeline file {}. Errno : {}", path,
+                    errno);
+        return false;
+    }
+
+    struct stat fileStat = {};
+    if (fstat(fileFd, &fileStat) == -1 ||
+        (static_cast<size_t>(fileStat.st_size) != mapSize &&
+         (readOnly || ftruncate(fileFd, mapSize) == -1)))
+    {
+        Logger::log(Logger::Subsystem::EVENTS, Logger::ERROR,
+                    "Timeline file {} can't be used. Errno : {}", path,
+                    errno);
+        close(fileFd);
+        return false;
+    }
+
+    void* address =
+        mmap(nullptr, mapSize, readOnly ? PROT_READ : PROT_READ | PROT_WRITE,
+             MAP_SHARED, fileFd, 0);
+    if (address == MAP_FAILED)
+    {
+        Logger::log(Logger::Subsystem::EVENTS, Logger::ERROR,
+                    "Failed to map timeline file {}. Errno : {}", path, errno);
+        close(fileFd);
+        return false;
+    }
+
+    auto* fileHeader = static_cast<Header*>(address);
+    if (fileHeader->magic != magic || fileHeader->version != version ||
+        fileHeader->capacity != capacity)
+    {
+        if (readOnly)
+        {
+            Logger::log(Logger::Subsystem::EVENTS, Logger::ERROR,
+                        "Timeline file {} is not valid", path);
+            munmap(address, mapSize);
+            close(fileFd);
+            return false;
+        }
+
+        // New file, or one written by another version of the app.
+        std::memset(address, 0, mapSize);
+        *fileHeader = Header{magic, version, capacity, 1, 0, 0, {}};
+    }
+
+    munmap(header, mapSize);
+    if (fd != -1)
+    {
+        close(fd);
+    }
+    fd = fileFd;
+    header = fileHeader;
+    entries = reinterpret_cast<Entry*>(header + 1);
+    return true;
+}
+
+void Timeline::startBoot()
+{
+    header->boot++;
+}
+
+void Timeline::append(const SrcRecord& srcRecord,
+                      const std::chrono::nanoseconds timestamp,
+                      const BootId& bmcBoot)
+{
+    // The clock going back tells a reboot when the boot id can't be read.
+    const auto time = static_cast<uint64_t>(timestamp.count());
+    if (header->count != 0 &&
+        (bmcBoot != header->bmcBoot ||
+         time < entries[(header->count - 1) % capacity].timestamp))
+    {
+        startBoot();
+    }
+    header->bmcBoot = bmcBoot;
+
+    auto& entry = entries[header->count % capacity];
+    entry.timestamp = time;
+    entry.boot = header->boot;
+    entry.hexWordCount = srcRecord.hexWordCount;
+    entry.reserved = {};
+    entry.src = srcRecord.src;
+    entry.hexWords = srcRecord.hexWords;
+
+    // Count is updated last, readers see the entry once it is complete.
+    header->count++;
+}
+
+size_t Timeline::size() const
+{
+    return static_cast<size_t>(std::min<uint64_t>(header->count, capacity));
+}
+
+Entry Timeline::at(const size_t pos) const
+{
+    if (pos >= size())
+    {
+        throw std::out_of_range("Timeline position out of range");
+    }
+    return entries[(header->count - size() + pos) % capacity];
+}
+
+uint32_t Timeline::currentBoot() const
+{
+    return header->boot;
+}
+
+Timeline& store()
+{
+    static Timeline appTimeline;
+    return appTimeline;
+}
+
+} // namespace timeline
+} // namespace panel
@@ -0,0 +1,106 @@
+#include "signal_dispatcher.hpp"
+
+#include "logger.hpp"
+
+#include <algorithm>
+
+namespace panel
+{
+void SignalDispatcher::subscribe(const std::string& name,
+                                 const SignalType type,
+                                 const std::string& path,
+                                 const std::string& interface, Handler handler)
+{
+    std::string rule;
+    switch (type)
+    {
+        case SignalType::PROPERTIES_CHANGED:
+            rule = sdbusplus::bus::match::rules::propertiesChanged(path,
+                                                                   interface);
+            break;
+
+        case SignalType::INTERFACES_ADDED:
+            rule = sdbusplus::bus::match::rules::interfacesAdded(path);
+            break;
+
+        case SignalType::INTERFACES_REMOVED:
+            rule = sdbusplus::bus::match::rules::interfacesRemoved(path);
+            break;
+    }
+
+    table.push_back(Entry{name,
+                          type,
+                          path,
+                          (type == SignalType::PROPERTIES_CHANGED)
+                              ? interface
+                              : std::string{},
+                          std::move(handler)});
+
+    if (std::find(rules.begin(), rules.end(), rule) != rules.end())
+    {
+        return;
+    }
+
+    matches.emplace_back(std::make_unique<sdbusplus::bus::match_t>(
+        *conn, rule,
+        [this, type](sdbusplus::message_t& msg) { dispatch(type, msg); }));
+    rules.emplace_back(std::move(rule));
+}
+
+void SignalDispatcher::dispatch(const SignalType type,
+                                sdbusplus::message_t& msg)
+{
+    const std::string_view path = msg.get_path();
+
+    std::string interface{};
+    if (type == SignalType::PROPERTIES_CHANGED)
+    {
+        msg.read(interface);
+    }
+
+    for (auto& entry : table)
+    {
+        if (entry.type != type || entry.path != path ||
+            entry.interface != interface)
+        {
+            continue;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        try
+        {
+            entry.handler(msg);
+        }
+        catch (const std::exception& e)
+        {
+            Logger::log(Logger::Subsystem::EVENTS, Logger::ERROR,
+                        "Handler for signal {} failed. {}", entry.name,
+                        e.what());
+        }
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start);
+
+        entry.count++;
+        entry.totalTime += elapsed;
+        entry.maxTime = std::max(entry.maxTime, elapsed);
+
+        // Message body is consumed by the handler.
+        return;
+    }
+}
+
+types::SignalStatistics SignalDispatcher::getStatistics() const
+{
+    types::SignalStatistics statistics;
+    for (const auto& entry : table)
+    {
+        statistics.emplace(
+            entry.name,
+            std::make_tuple(entry.count,
+                            static_cast<uint64_t>(entry.totalTime.count()),
+                            static_cast<uint64_t>(entry.maxTime.count())));
+    }
+    return statistics;
+}
+} // namespace panel
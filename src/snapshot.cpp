@@ -0,0 +1,405 @@
+#include "snapshot.hpp"
+
+#include "const.hpp"
+#include "event_recorder.hpp"
+#include "logger.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <array>
+#include <boost/crc.hpp>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+namespace panel
+{
+namespace snapshot
+{
+namespace
+{
+/* Identifies a snapshot file. */
+constexpr std::array<char, 8> magic{'P', 'N', 'L', 'S', 'N', 'A', 'P', '\0'};
+
+/* Version of the snapshot content, bumped on any change of PanelState. */
+constexpr uint32_t version = 2;
+
+/* Size of a slot, header included. */
+constexpr uint32_t slotSize = 16 * 1024;
+
+/* Number of slots in the file. */
+constexpr size_t slotCount = 2;
+
+/** @brief Start of the snapshot file. */
+struct FileHeader
+{
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t slotSize;
+};
+
+/** @brief Start of a slot, followed by the encoded state. */
+struct SlotHeader
+{
+    uint64_t sequence;
+    uint32_t length;
+    uint32_t checksum;
+};
+
+constexpr size_t fileSize = sizeof(FileHeader) + slotCount * slotSize;
+constexpr size_t slotCapacity = slotSize - sizeof(SlotHeader);
+
+/**
+ * @brief Checksum of a snapshot.
+ * @param[in] sequence - Sequence number.
+ * @param[in] data - Encoded state.
+ * @param[in] length - Length of the encoded state.
+ * @return CRC32 of the sequence, length and encoded state.
+ */
+uint32_t checksum(const uint64_t sequence, const types::Byte* data,
+                  const uint32_t length)
+{
+    boost::crc_32_type crc;
+    crc.process_bytes(&sequence, sizeof(sequence));
+    crc.process_bytes(&length, sizeof(length));
+    crc.process_bytes(data, length);
+    return crc.checksum();
+}
+
+/**
+ * @brief Append a list of callouts to a payload.
+ * @param[in] payload - Payload to append to.
+ * @param[in] callOuts - Rendered callouts.
+ */
+void encodeCallOuts(record::Payload& payload,
+                    const std::vector<CallOut>& callOuts)
+{
+    payload << static_cast<uint16_t>(callOuts.size());
+    for (const auto& callOut : callOuts)
+    {
+        for (const auto lineChar : callOut.line1)
+        {
+            payload << lineChar;
+        }
+        for (const auto lineChar : callOut.line2)
+        {
+            payload << lineChar;
+        }
+    }
+}
+
+/**
+ * @brief Read a list of callouts from a payload.
+ * @param[in] payload - Payload to read from.
+ * @param[out] callOuts - Rendered callouts.
+ */
+void decodeCallOuts(record::Payload& payload, std::vector<CallOut>& callOuts)
+{
+    uint16_t count = 0;
+    payload >> count;
+    if (count > CallOut::maxCallOuts)
+    {
+        throw std::runtime_error("Invalid callout count in snapshot");
+    }
+
+    callOuts.resize(count);
+    for (auto& callOut : callOuts)
+    {
+        for (auto& lineChar : callOut.line1)
+        {
+            payload >> lineChar;
+        }
+        for (auto& lineChar : callOut.line2)
+        {
+            payload >> lineChar;
+        }
+    }
+}
+
+/**
+ * @brief Append an SRC record to a payload.
+ * @param[in] payload - Payload to append to.
+ * @param[in] srcRecord - SRC record.
+ */
+void encodeSrcRecord(record::Payload& payload, const SrcRecord& srcRecord)
+{
+    for (const auto srcChar : srcRecord.src)
+    {
+        payload << srcChar;
+    }
+    payload << srcRecord.hexWordCount;
+    for (size_t word = 0; word < srcRecord.hexWordCount; ++word)
+    {
+        payload << srcRecord.hexWords[word];
+    }
+}
+
+/**
+ * @brief Read an SRC record from a payload.
+ * @param[in] payload - Payload to read from.
+ * @return SRC record.
+ */
+SrcRecord decodeSrcRecord(record::Payload& payload)
+{
+    SrcRecord srcRecord;
+    for (auto& srcChar : srcRecord.src)
+    {
+        payload >> srcChar;
+    }
+    payload >> srcRecord.hexWordCount;
+    if (srcRecord.hexWordCount > SrcRecord::maxHexWords)
+    {
+        throw std::runtime_error("Invalid hexword count in snapshot");
+    }
+    for (size_t word = 0; word < srcRecord.hexWordCount; ++word)
+    {
+        payload >> srcRecord.hexWords[word];
+    }
+    return srcRecord;
+}
+
+/**
+ * @brief Append a list of SRC records to a payload.
+ * @param[in] payload - Payload to append to.
+ * @param[in] history - List of SRC records, oldest first.
+ */
+void encodeHistory(record::Payload& payload, const SrcHistory& history)
+{
+    payload << static_cast<uint16_t>(history.size());
+    for (size_t pos = 0; pos < history.size(); ++pos)
+    {
+        encodeSrcRecord(payload, history.at(pos));
+    }
+}
+
+/**
+ * @brief Read a list of SRC records from a payload.
+ * @param[in] payload - Payload to read from.
+ * @param[out] history - List of SRC records, oldest first.
+ */
+void decodeHistory(record::Payload& payload, SrcHistory& history)
+{
+    uint16_t count = 0;
+    payload >> count;
+    history.clear();
+    for (uint16_t pos = 0; pos < count; ++pos)
+    {
+        history.push(decodeSrcRecord(payload));
+    }
+}
+} // namespace
+
+Store::~Store()
+{
+    if (mapped != nullptr)
+    {
+        munmap(mapped, fileSize);
+    }
+    if (fd != -1)
+    {
+        close(fd);
+    }
+}
+
+bool Store::open(const std::string& path)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(
+        std::filesystem::path(path).parent_path(), ec);
+
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd == -1)
+    {
+        Logger::log(Logger::Subsystem::APP, Logger::ERROR,
+                    "Failed to open snapshot file {}. Errno : {}", path,
+                    errno);
+        return false;
+    }
+
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) == -1 ||
+        (static_cast<size_t>(fileStat.st_size) != fileSize &&
+         ftruncate(fd, fileSize) == -1))
+    {
+        Logger::log(Logger::Subsystem::APP, Logger::ERROR,
+                    "Failed to size snapshot file {}. Errno : {}", path,
+                    errno);
+        close(fd);
+        fd = -1;
+        return false;
+    }
+
+    void* address =
+        mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED)
+    {
+        Logger::log(Logger::Subsystem::APP, Logger::ERROR,
+                    "Failed to map snapshot file {}. Errno : {}", path, errno);
+        close(fd);
+        fd = -1;
+        return false;
+    }
+    mapped = static_cast<types::Byte*>(address);
+
+    FileHeader header{};
+    std::memcpy(&header, mapped, sizeof(header));
+    if (header.magic != magic || header.version != version ||
+        header.slotSize != slotSize)
+    {
+        // New file, or one written by another version of the app.
+        std::memset(mapped, 0, fileSize);
+        header = FileHeader{magic, version, slotSize};
+        std::memcpy(mapped, &header, sizeof(header));
+    }
+
+    for (size_t slot = 0; slot < slotCount; ++slot)
+    {
+        const auto sequence = validSequence(slot);
+        if (sequence && *sequence > latestSequence)
+        {
+            latestSequence = *sequence;
+            latestSlot = slot;
+        }
+    }
+    return true;
+}
+
+types::Byte* Store::slotAt(const size_t slot) const
+{
+    return mapped + sizeof(FileHeader) + slot * slotSize;
+}
+
+std::optional<uint64_t> Store::validSequence(const size_t slot) const
+{
+    SlotHeader header{};
+    std::memcpy(&header, slotAt(slot), sizeof(header));
+
+    if (header.sequence == 0 || header.length > slotCapacity ||
+        header.checksum != checksum(header.sequence,
+                                    slotAt(slot) + sizeof(SlotHeader),
+                                    header.length))
+    {
+        return std::nullopt;
+    }
+    return header.sequence;
+}
+
+std::optional<PanelState> Store::load() const
+{
+    if (mapped == nullptr || latestSequence == 0)
+    {
+        return std::nullopt;
+    }
+
+    SlotHeader header{};
+    std::memcpy(&header, slotAt(latestSlot), sizeof(header));
+    const auto* data = slotAt(latestSlot) + sizeof(SlotHeader);
+
+    try
+    {
+        record::Payload payload(types::Binary(data, data + header.length));
+        PanelState state;
+        decodeHistory(payload, state.pelSrcs);
+        bool hasLatestSrc = false;
+        payload >> hasLatestSrc;
+        if (hasLatestSrc)
+        {
+            state.latestSrc = decodeSrcRecord(payload);
+        }
+        decodeCallOuts(payload, state.callOutList);
+        payload >> state.systemState >> state.currentFunction;
+        return state;
+    }
+    catch (const std::exception& e)
+    {
+        Logger::log(Logger::Subsystem::APP, Logger::ERROR,
+                    "Failed to decode panel snapshot. {}", e.what());
+    }
+    return std::nullopt;
+}
+
+void Store::save(const PanelState& state)
+{
+    if (mapped == nullptr)
+    {
+        return;
+    }
+
+    record::Payload payload;
+    encodeHistory(payload, state.pelSrcs);
+    payload << state.latestSrc.has_value();
+    if (state.latestSrc)
+    {
+        encodeSrcRecord(payload, *state.latestSrc);
+    }
+    encodeCallOuts(payload, state.callOutList);
+    payload << state.systemState << state.currentFunction;
+
+    const auto& data = payload.data();
+    if (data.size() > slotCapacity)
+    {
+        Logger::log(Logger::Subsystem::APP, Logger::ERROR,
+                    "Panel snapshot of {} bytes exceeds the slot, not saved",
+                    data.size());
+        return;
+    }
+
+    // Write to the other slot, the latest snapshot stays valid till the new
+    // one is complete.
+    const size_t slot = (latestSlot + 1) % slotCount;
+    const SlotHeader header{
+        latestSequence + 1, static_cast<uint32_t>(data.size()),
+        checksum(latestSequence + 1, data.data(),
+                 static_cast<uint32_t>(data.size()))};
+
+    std::memcpy(slotAt(slot) + sizeof(SlotHeader), data.data(), data.size());
+    std::memcpy(slotAt(slot), &header, sizeof(header));
+
+    // Pages of a shared mapping survive the app crashing, schedule the write
+    // back without blocking the event loop.
+    msync(mapped, fileSize, MS_ASYNC);
+
+    latestSlot = slot;
+    latestSequence = header.sequence;
+}
+
+void Store::enableAutoSave(std::shared_ptr<boost::asio::io_context>& io,
+                           Collector stateCollector)
+{
+    collector = std::move(stateCollector);
+    saveTimer = std::make_unique<boost::asio::steady_timer>(*io);
+}
+
+void Store::markDirty()
+{
+    if (!saveTimer || isSavePending)
+    {
+        return;
+    }
+
+    isSavePending = true;
+    saveTimer->expires_after(constants::snapshotSaveDelay);
+    saveTimer->async_wait([this](const boost::system::error_code& ec) {
+        isSavePending = false;
+        if (ec == boost::asio::error::operation_aborted)
+        {
+            return;
+        }
+
+        PanelState state;
+        collector(state);
+        save(state);
+    });
+}
+
+Store& store()
+{
+    static Store appStore;
+    return appStore;
+}
+
+} // namespace snapshot
+} // namespace panel
@@ -0,0 +1,103 @@
+#include "src_record.hpp"
+
+#include <algorithm>
+#include <charconv>
+
+namespace panel
+{
+namespace
+{
+/* Upper case hex digits of every byte value. */
+constexpr auto hexDigits = [] {
+    constexpr std::string_view digits = "0123456789ABCDEF";
+    std::array<std::array<char, 2>, 256> table{};
+    for (size_t value = 0; value < table.size(); ++value)
+    {
+        table[value] = {digits[value >> 4], digits[value & 0x0F]};
+    }
+    return table;
+}();
+
+/**
+ * @brief Format a hexword as 8 upper case hex digits.
+ * @param[in] hexWord - Hexword.
+ * @param[in] out - Position to format at.
+ * @return Position past the hexword.
+ */
+template <typename Iterator>
+Iterator formatHexWord(const uint32_t hexWord, Iterator out)
+{
+    for (int shift = 24; shift >= 0; shift -= 8)
+    {
+        out = std::copy_n(hexDigits[(hexWord >> shift) & 0xFF].begin(), 2,
+                          out);
+    }
+    return out;
+}
+} // namespace
+
+std::string_view SrcRecord::toText(TextBuffer& buffer) const
+{
+    auto out = std::copy(src.begin(), src.end(), buffer.begin());
+    for (size_t word = 0; word < hexWordCount; ++word)
+    {
+        *out++ = ' ';
+        out = formatHexWord(hexWords[word], out);
+    }
+    return std::string_view(buffer.data(), out - buffer.begin());
+}
+
+std::string_view SrcRecord::toHexWordLine(const size_t firstWord,
+                                          HexWordLine& line) const
+{
+    line.fill(' ');
+    auto out = line.begin();
+    for (size_t word = firstWord; word < firstWord + 2; ++word)
+    {
+        out = (word < hexWordCount) ? formatHexWord(hexWords[word], out)
+                                    : out + 8;
+    }
+    return std::string_view(line.data(), line.size());
+}
+
+SrcRecord SrcRecord::fromSrc(std::string_view srcChars)
+{
+    SrcRecord record;
+    record.src.fill(' ');
+    std::copy_n(srcChars.begin(), std::min(srcChars.size(), srcLength),
+                record.src.begin());
+    return record;
+}
+
+SrcRecord SrcRecord::fromEventId(std::string_view eventId)
+{
+    auto record = fromSrc(eventId.substr(0, eventId.find(' ')));
+
+    auto pos = eventId.find(' ');
+    while (pos != std::string_view::npos && record.hexWordCount < maxHexWords)
+    {
+        pos = eventId.find_first_not_of(' ', pos);
+        if (pos == std::string_view::npos)
+        {
+            break;
+        }
+
+        const auto* begin = eventId.data() + pos;
+        const auto* end = eventId.data() + eventId.size();
+        uint32_t hexWord = 0;
+        const auto [next, ec] = std::from_chars(begin, end, hexWord, 16);
+        if (ec != std::errc() || (next != end && *next != ' '))
+        {
+            break;
+        }
+
+        record.hexWords[record.hexWordCount++] = hexWord;
+        pos = next - eventId.data();
+        if (next == end)
+        {
+            break;
+        }
+    }
+    return record;
+}
+} // namespace panel
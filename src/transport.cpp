@@ -4,6 +4,7 @@
 #include "const.hpp"
 #include "i2c_message_encoder.hpp"
 #include "lcd_fw_latest.hpp"
+#include "logger.hpp"
 #include "utils.hpp"
 
 #include <fcntl.h>
@@ -19,6 +20,11 @@ using namespace std::chrono_literals;
 
 namespace panel
 {
+namespace
+{
+constexpr auto logSubsystem = Logger::Subsystem::TRANSPORT;
+} // namespace
+
 void Transport::panelI2CSetup()
 {
     std::ostringstream byteStream;
@@ -68,12 +74,18 @@ void Transport::panelI2CSetup()
             "xyz.openbmc_project.Logging.Entry.Level.Warning", additionData);
         throw std::runtime_error(error);
     }
-    std::cout << "Success opening and accessing the device path: " << devPath
-              << std::endl;
+    Logger::log(logSubsystem, Logger::INFO,
+                "Success opening and accessing the device path: {}", devPath);
 }
 
 void Transport::panelI2CWrite(const types::Binary& buffer) const
 {
+    if (transportKey && isEmulated)
+    {
+        ++emulatedWriteCount;
+        return;
+    }
+
     if (transportKey)
     {
         if (buffer.size()) // check if the given buffer has data in it.
@@ -109,11 +121,12 @@ void Transport::panelI2CWrite(const types::Binary& buffer) const
             }
             if (writeFailed == true)
             {
-                std::cerr << "\n I2C Write failure. Errno : " << failedErrno
-                          << ". Errno description : " << strerror(failedErrno)
-                          << ". Bytes written = " << returnedSize
-                          << ". Actual Bytes = " << buffer.size()
-                          << ". Retry = " << retriesDone << std::endl;
+                Logger::log(logSubsystem, Logger::ERROR,
+                            "I2C Write failure. Errno : {}. Errno description "
+                            ": {}. Bytes written = {}. Actual Bytes = {}. "
+                            "Retry = {}",
+                            failedErrno, strerror(failedErrno), returnedSize,
+                            buffer.size(), retriesDone);
                 std::map<std::string, std::string> additionData{};
                 additionData.emplace("DESCRIPTION", strerror(failedErrno));
                 additionData.emplace("CALLOUT_IIC_BUS", devPath);
@@ -128,7 +141,8 @@ void Transport::panelI2CWrite(const types::Binary& buffer) const
         }
         else
         {
-            std::cerr << "\n Buffer empty. Skipping I2C Write." << std::endl;
+            Logger::log(logSubsystem, Logger::ERROR,
+                        "Buffer empty. Skipping I2C Write.");
         }
     }
 }
@@ -139,14 +153,14 @@ void Transport::doButtonConfig()
     panelI2CWrite(encode.buttonControl(0x00, 0x01));
     panelI2CWrite(encode.buttonControl(0x01, 0x01));
     panelI2CWrite(encode.buttonControl(0x02, 0x01));
-    std::cout << "\n Button configuration done." << std::endl;
+    Logger::log(logSubsystem, Logger::INFO, "Button configuration done.");
 }
 
 void Transport::doSoftReset()
 {
     panelI2CWrite(encoder::MessageEncoder().softReset());
     std::this_thread::sleep_for(3000ms);
-    std::cout << "\n Panel:Soft reset done." << std::endl;
+    Logger::log(logSubsystem, Logger::INFO, "Panel:Soft reset done.");
 }
 
 void Transport::checkAndFixBootLoaderBug()
@@ -164,43 +178,46 @@ void Transport::checkAndFixBootLoaderBug()
             ::read(panelFileDescriptor, readBuff.data(), readBuff.size());
         if (readSize != (int)readBuff.size())
         {
-            std::cerr << "Failed to read panel version. Read bytes: "
-                      << readSize << ", retry: " << retries
-                      << ", errno: " << errno << std::endl;
+            Logger::log(logSubsystem, Logger::ERROR,
+                        "Failed to read panel version. Read bytes: {}, retry: "
+                        "{}, errno: {}",
+                        readSize, retries, errno);
             continue;
         }
 
-        // TODO: Uncomment when we have dynamic logging
-        // std::cout << "Version read from panel: " << readBuff[0] <<
-        // readBuff[1]
-        //          << std::endl;
+        Logger::log(logSubsystem, Logger::DEBUG,
+                    "Version read from panel: {}{}",
+                    static_cast<char>(readBuff[0]),
+                    static_cast<char>(readBuff[1]));
 
         if (readBuff[0] == 'M' && readBuff[1] == 'P')
         {
-            std::cout << "Validated that the panel is running the main program"
-                      << std::endl;
+            Logger::log(logSubsystem, Logger::INFO,
+                        "Validated that the panel is running the main program");
             return;
         }
 
         // If we are in BL, call write to jump to MP.
         if (readBuff[0] == 'B' && readBuff[1] == 'L')
         {
-            std::cerr << "Panel is stuck in bootloader, attempting recovery..."
-                      << std::endl;
+            Logger::log(logSubsystem, Logger::ERROR,
+                        "Panel is stuck in bootloader, attempting recovery...");
             auto writeSize = ::write(panelFileDescriptor, writeBuff.data(),
                                      writeBuff.size());
             if (writeSize != (int)writeBuff.size())
             {
-                std::cerr << "Failed to write panel jump command. Wrote bytes: "
-                          << writeSize << ", retry: " << retries
-                          << ", errno: " << errno << std::endl;
-                std::cerr << "This is expected if the errno is 5" << std::endl;
+                Logger::log(logSubsystem, Logger::ERROR,
+                            "Failed to write panel jump command. Wrote bytes: "
+                            "{}, retry: {}, errno: {}. This is expected if the "
+                            "errno is 5",
+                            writeSize, retries, errno);
             }
             std::this_thread::sleep_for(1s);
         }
     }
 
-    std::cerr << "Failed to determine OR fix bootloader bug ... " << std::endl;
+    Logger::log(logSubsystem, Logger::ERROR,
+                "Failed to determine OR fix bootloader bug ... ");
 }
 
 bool Transport::readPanelVersion(types::Binary& versionBuffer) const
@@ -213,9 +230,10 @@ bool Transport::readPanelVersion(types::Binary& versionBuffer) const
 
     if (readSize != versionSize)
     {
-        std::cerr << "Failed to read panel current version [" << devPath << ", "
-                  << i2cAddress << "]. Bytes read: " << readSize
-                  << ", errno: " << errno << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Failed to read panel current version [{}, {}]. Bytes "
+                    "read: {}, errno: {}",
+                    devPath, i2cAddress, readSize, errno);
         if (constants::errnoNoDeviceOrAddress == errno)
         {
             // creating errorlog as device not found, it could be due to
@@ -253,9 +271,10 @@ void Transport::doFWUpdate() const
                 constants::codeUpdateFailure);
             return;
         }
-        std::cerr << "\n The Op-panel at " << devPath << ", " << i2cAddress
-                  << " has not reached the Main Program. Aborting code update."
-                  << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "The Op-panel at {}, {} has not reached the Main Program. "
+                    "Aborting code update.",
+                    devPath, i2cAddress);
         return;
     }
 
@@ -267,8 +286,9 @@ void Transport::doFWUpdate() const
         currentVersion = v;
     }
 
-    std::cout << "\n The current version of Op-panel at " << devPath << ", "
-              << i2cAddress << " is " << currentVersion.str() << std::endl;
+    Logger::log(logSubsystem, Logger::INFO,
+                "The current version of Op-panel at {}, {} is {}", devPath,
+                i2cAddress, currentVersion.str());
 
     types::PanelVersion maxVersion =
         (panelType == types::PanelType::LCD)
@@ -277,9 +297,10 @@ void Transport::doFWUpdate() const
 
     if (currentVersion == maxVersion || currentVersion > maxVersion)
     {
-        std::cout << "\nOp-panel at " << devPath << ", " << i2cAddress
-                  << " has the latest version " << currentVersion.str()
-                  << ". Code update not required." << std::endl;
+        Logger::log(logSubsystem, Logger::INFO,
+                    "Op-panel at {}, {} has the latest version {}. Code update "
+                    "not required.",
+                    devPath, i2cAddress, currentVersion.str());
         return;
     }
     else if (currentVersion < constants::minPanelVersion)
@@ -293,24 +314,27 @@ void Transport::doFWUpdate() const
 
     if (!gotoBootloader())
     {
-        std::cerr << "\nFailed to switch to boot loader. Code update failed "
-                     "for Op-panel at "
-                  << devPath << ", " << i2cAddress << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Failed to switch to boot loader. Code update failed for "
+                    "Op-panel at {}, {}",
+                    devPath, i2cAddress);
         return;
     }
 
     if (!updateFlash())
     {
-        std::cerr << "\nFlash failed. Aborting code update for Op-panel at "
-                  << devPath << ", " << i2cAddress << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Flash failed. Aborting code update for Op-panel at {}, {}",
+                    devPath, i2cAddress);
         return;
     }
 
     if (!gotoMainProgram())
     {
-        std::cerr << "\nFailed jumping to main program after a code update for "
-                     "Op-panel at "
-                  << devPath << ", " << i2cAddress << std::endl;
+        Logger::log(logSubsystem, Logger::ERROR,
+                    "Failed jumping to main program after a code update for "
+                    "Op-panel at {}, {}",
+                    devPath, i2cAddress);
         return;
     }
     else
@@ -325,10 +349,10 @@ void Transport::doFWUpdate() const
 
             if (currentVersion == maxVersion)
             {
-                std::cout
-                    << "\nFirmware update successful to the latest version "
-                    << currentVersion.str() << " for the op-panel at "
-                    << devPath << ", " << i2cAddress << std::endl;
+                Logger::log(logSubsystem, Logger::INFO,
+                            "Firmware update successful to the latest version "
+                            "{} for the op-panel at {}, {}",
+                            currentVersion.str(), devPath, i2cAddress);
                 return;
             }
             logCodeUpdateError("Failed updating firmware to the latest version",
@@ -343,7 +367,7 @@ void Transport::setTransportKey(bool keyValue)
 {
     transportKey = keyValue;
 
-    if (transportKey)
+    if (transportKey && !isEmulated)
     {
         // When setting key to true, check if the panel is stuck in the
         // bootloader
@@ -351,15 +375,15 @@ void Transport::setTransportKey(bool keyValue)
         doFWUpdate();
     }
 
-    if (transportKey && (panelType == types::PanelType::LCD))
+    if (transportKey && !isEmulated && (panelType == types::PanelType::LCD))
     {
         doSoftReset();
         doButtonConfig();
     }
 
-    std::cout << "\nTransport key is set to " << transportKey
-              << " for the panel at " << devPath << ", " << i2cAddress
-              << std::endl;
+    Logger::log(logSubsystem, Logger::INFO,
+                "Transport key is set to {} for the panel at {}, {}",
+                transportKey, devPath, i2cAddress);
 }
 
 bool Transport::gotoBootloader() const
@@ -1,8 +1,10 @@
 #include "utils.hpp"
 
+#include "bios_attributes.hpp"
 #include "const.hpp"
 #include "exception.hpp"
 #include "i2c_message_encoder.hpp"
+#include "logger.hpp"
 
 #include <libpldm/platform.h>
 
@@ -10,9 +12,6 @@ namespace panel
 {
 namespace utils
 {
-// Global variables to restore state of display lines.
-std::string restoreLine1, restoreLine2;
-
 std::string binaryToHexString(const types::Binary& val)
 {
     std::ostringstream oss;
@@ -41,8 +40,9 @@ void createPEL(const std::string& errIntf, const std::string& sev,
     }
     catch (const sdbusplus::exception_t& e)
     {
-        std::cerr << "Error in invoking D-Bus logging create interface to "
-                     "register PEL";
+        Logger::log(Logger::Subsystem::APP, Logger::ERROR,
+                    "Error in invoking D-Bus logging create interface to "
+                    "register PEL");
     }
 }
 
@@ -76,16 +76,8 @@ std::string getService(sdbusplus::bus_t& bus, const std::string& path,
 void sendCurrDisplayToPanel(const std::string& line1, const std::string& line2,
                             std::shared_ptr<Transport> transport)
 {
-    // TODO: via https://github.com/ibm-openbmc/ibm-panel/issues/37
-    // Make these couts and other traces in the code configurable. Keeping
-    // these commented until then as they flood the systemd journal.
-    // couts are for debugging purpose. can be removed once the testing is done.
-    // std::cout << "L1 : " << line1 << std::endl;
-    // std::cout << "L2 : " << line2 << std::endl;
-
-    // Restore the values of display lines
-    restoreLine1 = line1;
-    restoreLine2 = line2;
+    Logger::log(Logger::Subsystem::TRANSPORT, Logger::DEBUG, "L1 : {}", line1);
+    Logger::log(Logger::Subsystem::TRANSPORT, Logger::DEBUG, "L2 : {}", line2);
 
     encoder::MessageEncoder encode;
 
@@ -110,64 +102,6 @@ void sendCurrDisplayToPanel(const std::string& line1, const std::string& line2,
     }
 }
 
-types::SystemParameterValues readSystemParameters()
-{
-    auto retVal = readBusProperty<std::variant<types::BiosBaseTable>>(
-        "xyz.openbmc_project.BIOSConfigManager",
-        "/xyz/openbmc_project/bios_config/manager",
-        "xyz.openbmc_project.BIOSConfig.Manager", "BaseBIOSTable");
-
-    const auto baseBiosTable = std::get_if<types::BiosBaseTable>(&retVal);
-
-    // system parameters to be read from BIOS table
-    std::string OSBootType{};
-    std::string HMCManaged{};
-    std::string FWIPLType{};
-    std::string hypType{};
-    std::string systemOperatingMode{};
-
-    if (baseBiosTable != nullptr)
-    {
-        for (const types::BiosBaseTableItem& item : *baseBiosTable)
-        {
-            const auto attributeName = std::get<0>(item);
-            const auto attrValue = std::get<5>(std::get<1>(item));
-            const auto val = std::get_if<std::string>(&attrValue);
-
-            if (val != nullptr)
-            {
-                // TODO: How to get the information from PLDM if IPL type is
-                // enabled to be displayed. Based on that execution of
-                // function 01 needs to be updated to display this data.
-                // Currently it is disabled in the code explicitly.
-                if (attributeName == "pvm_os_boot_type")
-                {
-                    OSBootType = *val;
-                }
-                else if (attributeName == "pvm_hmc_managed")
-                {
-                    HMCManaged = *val;
-                }
-                else if (attributeName == "hb_hyp_switch")
-                {
-                    hypType = *val;
-                }
-                else if (attributeName == "pvm_system_operating_mode")
-                {
-                    systemOperatingMode = *val;
-                }
-            }
-        }
-    }
-    else
-    {
-        std::cerr << "Failed to read BIOS base table" << std::endl;
-    }
-
-    return std::make_tuple(OSBootType, systemOperatingMode, HMCManaged,
-                           FWIPLType, hypType);
-}
-
 types::GetManagedObjects getManagedObjects(const std::string& service,
                                            const std::string& object)
 {
@@ -183,48 +117,27 @@ types::GetManagedObjects getManagedObjects(const std::string& service,
     }
     catch (const sdbusplus::exception::SdBusError& e)
     {
-        std::cerr << e.what();
+        Logger::log(Logger::Subsystem::APP, Logger::ERROR, "{}", e.what());
     }
     return retVal;
 }
 
 void getNextBootSide(std::string& nextBootSide)
 {
-    std::string valueType;
-    std::variant<std::string> bootSideValue;
-    std::variant<std::string> var3;
-
-    auto bus = sdbusplus::bus::new_default();
-    auto method = bus.new_method_call(
-        "xyz.openbmc_project.BIOSConfigManager",
-        "/xyz/openbmc_project/bios_config/manager",
-        "xyz.openbmc_project.BIOSConfig.Manager", "GetAttribute");
-    method.append("fw_boot_side");
-    auto result = bus.call(method);
-    result.read(valueType, bootSideValue, var3);
-
-    if (auto bootSide = std::get_if<std::string>(&bootSideValue))
+    const auto& bootSide =
+        bios::attributes().get(bios::Attribute::FW_BOOT_SIDE);
+
+    if (!bootSide.empty())
     {
-        if (*bootSide == "Perm")
-        {
-            nextBootSide = "P";
-        }
-        else
-        {
-            nextBootSide = "T";
-        }
+        nextBootSide = (bootSide == "Perm") ? "P" : "T";
     }
 }
 
 void doLampTest(std::shared_ptr<Transport>& transport)
 {
     transport->panelI2CWrite(encoder::MessageEncoder().lampTest());
-    std::cout << "\nPanel lamp test initiated." << std::endl;
-}
-
-void restoreDisplayOnPanel(std::shared_ptr<Transport>& transport)
-{
-    sendCurrDisplayToPanel(restoreLine1, restoreLine2, transport);
+    Logger::log(Logger::Subsystem::TRANSPORT, Logger::INFO,
+                "Panel lamp test initiated.");
 }
 
 types::PdrList getPDR(const uint8_t& terminusId, const uint16_t& entityId,
@@ -243,7 +156,7 @@ types::PdrList getPDR(const uint8_t& terminusId, const uint16_t& entityId,
     }
     catch (const sdbusplus::exception::SdBusError& e)
     {
-        std::cerr << e.what() << std::endl;
+        Logger::log(Logger::Subsystem::PLDM, Logger::ERROR, "{}", e.what());
         throw FunctionFailure("pldm: Failed to fetch the PDR.");
     }
     return pdrs;
@@ -280,7 +193,7 @@ std::vector<std::string> getSubTreePaths(const std::string& objectPath,
     }
     catch (const sdbusplus::exception::SdBusError& e)
     {
-        std::cerr << e.what();
+        Logger::log(Logger::Subsystem::APP, Logger::ERROR, "{}", e.what());
     }
 
     return result;
@@ -297,7 +210,8 @@ std::string getSystemIM()
     }
     else
     {
-        std::cerr << "\n Failed querying IM property from dbus" << std::endl;
+        Logger::log(Logger::Subsystem::APP, Logger::ERROR,
+                    "Failed querying IM property from dbus");
     }
     return "";
 }
@@ -314,8 +228,8 @@ bool getLcdPanelPresentProperty(const std::string& imValue)
     }
     else
     {
-        std::cerr << "\n Failed querying Present property from dbus."
-                  << std::endl;
+        Logger::log(Logger::Subsystem::APP, Logger::ERROR,
+                    "Failed querying Present property from dbus.");
     }
     return false;
 }
@@ -364,23 +278,23 @@ void filterPel(const types::GetManagedObjects& listOfPels,
                                 }
                                 continue;
                             }
-                            std::cerr << "Error fetching value for Event ID. "
-                                         "Not a normal case. Ignoring the PEL"
-                                      << std::endl;
+                            Logger::log(Logger::Subsystem::EVENTS,
+                                        Logger::ERROR,
+                                        "Error fetching value for Event ID. "
+                                        "Not a normal case. Ignoring the PEL");
                             continue;
                         }
-                        std::cerr << "Mandatory field EventId is missing from "
-                                     "PEL. Ignoring the PEL."
-                                  << std::endl;
+                        Logger::log(Logger::Subsystem::EVENTS, Logger::ERROR,
+                                    "Mandatory field EventId is missing from "
+                                    "PEL. Ignoring the PEL.");
                         continue;
                     }
                 }
                 else
                 {
-                    std::cerr
-                        << "Mandatory field severity is missing from PEL. "
-                           "Ignoring the PEL"
-                        << std::endl;
+                    Logger::log(Logger::Subsystem::EVENTS, Logger::ERROR,
+                                "Mandatory field severity is missing from "
+                                "PEL. Ignoring the PEL");
                 }
             }
         }
@@ -410,16 +324,21 @@ void sortPels(types::GetManagedObjects& listOfPels)
     {
         // stoi (and sort) can throw. Make sure we handle it such that we can
         // still continue.
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::cerr << "Failed to sort existing list of PELs" << std::endl;
+        Logger::log(Logger::Subsystem::EVENTS, Logger::ERROR,
+                    "Exception: {}. Failed to sort existing list of PELs",
+                    e.what());
     }
 }
 
 types::PelPathAndSRCList geListOfPELsAndSRCs()
 {
-    auto listOfPels = getManagedObjects("xyz.openbmc_project.Logging",
-                                        "/xyz/openbmc_project/logging");
+    return geListOfPELsAndSRCs(getManagedObjects(
+        "xyz.openbmc_project.Logging", "/xyz/openbmc_project/logging"));
+}
 
+types::PelPathAndSRCList
+    geListOfPELsAndSRCs(types::GetManagedObjects listOfPels)
+{
     types::PelPathAndSRCList finalListOfFPELs{};
     if (!listOfPels.empty())
     {
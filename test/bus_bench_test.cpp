@@ -0,0 +1,29 @@
+#include "bus_bench.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace panel::tool;
+
+TEST(BusBench, parseBenchMethods)
+{
+    EXPECT_EQ((std::vector<BenchMethod>{BenchMethod::GET_ENABLED_FUNCTIONS,
+                                        BenchMethod::DISPLAY}),
+              parseBenchMethods("getEnabledFunctions,Display"));
+    EXPECT_EQ((std::vector<BenchMethod>{BenchMethod::DISPLAY,
+                                        BenchMethod::PROCESS_BUTTON,
+                                        BenchMethod::GET_ENABLED_FUNCTIONS,
+                                        BenchMethod::EXECUTE_FUNCTION}),
+              parseBenchMethods("all"));
+}
+
+TEST(BusBench, parseBenchMethodsInvalid)
+{
+    EXPECT_THROW(parseBenchMethods(""), std::runtime_error);
+    EXPECT_THROW(parseBenchMethods("display"), std::runtime_error);
+    EXPECT_THROW(parseBenchMethods("Display,,ProcessButton"),
+                 std::runtime_error);
+    EXPECT_THROW(parseBenchMethods("Display,Unknown"), std::runtime_error);
+}
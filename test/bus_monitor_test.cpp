@@ -0,0 +1,98 @@
+#include "bus_monitor.hpp"
+#include "const.hpp"
+#include "executor.hpp"
+#include "panel_state_manager.hpp"
+#include "progress_code.hpp"
+#include "progress_timeline.hpp"
+#include "signal_dispatcher.hpp"
+#include "transport.hpp"
+
+#include <sdbusplus/asio/connection.hpp>
+#include <sdbusplus/asio/object_server.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace panel;
+
+namespace
+{
+/**
+ * @brief Progress code holding an SRC.
+ * @param[in] src - 8 character SRC.
+ * @return Progress code, first character in the least significant byte.
+ */
+uint64_t toProgressCode(const std::string& src)
+{
+    uint64_t code = 0;
+    for (size_t pos = 0; pos < 8; ++pos)
+    {
+        code |= uint64_t{static_cast<uint8_t>(src[pos])} << (8 * pos);
+    }
+    return code;
+}
+} // namespace
+
+TEST(BootProgressCode, terminating_src_replaces_pending_code)
+{
+    auto io = std::make_shared<boost::asio::io_context>();
+    auto conn = std::make_shared<sdbusplus::asio::connection>(*io);
+    auto iface = std::make_shared<sdbusplus::asio::dbus_interface>(
+        conn, std::string{}, std::string{});
+    auto dispatcher = std::make_shared<SignalDispatcher>(conn);
+    auto transport = std::make_shared<Transport>();
+    auto executor = std::make_shared<Executor>(transport, conn, iface, io);
+    auto stateManager =
+        std::make_shared<state::manager::PanelStateManager>(transport,
+                                                            executor);
+
+    BootProgressCode progressCode(io, transport, dispatcher, executor);
+    PELListener pelListener(conn, dispatcher, stateManager, executor,
+                            transport, progressCode);
+
+    // The second code arrives within the dwell of the first, it is held back.
+    const std::vector<types::Byte> noHexWords(
+        progress_code::hexWordDataLength, ' ');
+    progressCode.processProgressCode({toProgressCode("C1001F00"), noHexWords});
+    progressCode.processProgressCode({toProgressCode("C7004091"), noHexWords});
+    EXPECT_EQ("C1001F00", executor->getRenderer().getFrame().line1);
+
+    // Terminating SRC of the BMC is shown at once.
+    pelListener.processPelAdded(
+        "/xyz/openbmc_project/logging/entry/1", std::string{},
+        "BD8D1001 00000055 00000000 2E2D0010 A0000000 00000000 00000000 "
+        "00000000 0000FFFF");
+    EXPECT_EQ("BD8D1001", executor->getRenderer().getFrame().line1);
+
+    // The end of the dwell does not bring the held back code back.
+    io->run_for(constants::progressCodeDwell + std::chrono::milliseconds(100));
+    EXPECT_EQ("BD8D1001", executor->getRenderer().getFrame().line1);
+}
+
+TEST(BootProgressCode, timeline_keeps_hexwords)
+{
+    auto io = std::make_shared<boost::asio::io_context>();
+    auto conn = std::make_shared<sdbusplus::asio::connection>(*io);
+    auto iface = std::make_shared<sdbusplus::asio::dbus_interface>(
+        conn, std::string{}, std::string{});
+    auto dispatcher = std::make_shared<SignalDispatcher>(conn);
+    auto transport = std::make_shared<Transport>();
+    auto executor = std::make_shared<Executor>(transport, conn, iface, io);
+    BootProgressCode progressCode(io, transport, dispatcher, executor);
+
+    // SRC word and two hexwords are valid.
+    std::vector<types::Byte> hexWordData(progress_code::hexWordDataLength,
+                                         0);
+    hexWordData[3] = 3;
+    hexWordData[progress_code::hexWordOffset + 3] = 0x20;
+    hexWordData[progress_code::hexWordOffset + 4] = 0x12;
+    hexWordData[progress_code::hexWordOffset + 7] = 0x34;
+    progressCode.processProgressCode({toProgressCode("C1001F00"), hexWordData});
+
+    const auto& timeline = timeline::store();
+    ASSERT_NE(0, timeline.size());
+    const auto entry = timeline.at(timeline.size() - 1);
+    EXPECT_EQ("C1001F00", entry.toSrcRecord().getSrc());
+    ASSERT_EQ(2, entry.hexWordCount);
+    EXPECT_EQ(0x20, entry.hexWords[0]);
+    EXPECT_EQ(0x12000034, entry.hexWords[1]);
+}
@@ -0,0 +1,59 @@
+#include "button_script.hpp"
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace panel;
+using namespace panel::tool;
+using types::ButtonEvent;
+
+namespace
+{
+/**
+ * @brief Parse a script held in a string.
+ * @param[in] text - Script.
+ * @return Button events.
+ */
+std::vector<ButtonEvent> parse(const std::string& text)
+{
+    std::istringstream script(text);
+    return parseButtonScript(script);
+}
+} // namespace
+
+TEST(ButtonScript, events)
+{
+    EXPECT_EQ((std::vector<ButtonEvent>{ButtonEvent::INCREMENT,
+                                        ButtonEvent::INCREMENT,
+                                        ButtonEvent::EXECUTE,
+                                        ButtonEvent::DECREMENT}),
+              parse("UP*2 EXECUTE\n  DOWN\n"));
+    EXPECT_EQ(std::vector<ButtonEvent>(5, ButtonEvent::INCREMENT),
+              parse("UP*5"));
+}
+
+TEST(ButtonScript, comments)
+{
+    EXPECT_EQ(std::vector<ButtonEvent>{ButtonEvent::EXECUTE},
+              parse("# Go to function 02\nEXECUTE # UP DOWN\n#DOWN"));
+}
+
+TEST(ButtonScript, empty)
+{
+    EXPECT_TRUE(parse("").empty());
+    EXPECT_TRUE(parse("\n  \n# Nothing to send\n").empty());
+}
+
+TEST(ButtonScript, invalid)
+{
+    EXPECT_THROW(parse("UP*0"), std::runtime_error);
+    EXPECT_THROW(parse("UP*"), std::runtime_error);
+    EXPECT_THROW(parse("UP*2x"), std::runtime_error);
+    EXPECT_THROW(parse("*5"), std::runtime_error);
+    EXPECT_THROW(parse("up"), std::runtime_error);
+    EXPECT_THROW(parse("UP LEFT"), std::runtime_error);
+}
@@ -0,0 +1,52 @@
+#include "callout.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace panel;
+
+TEST(CallOut, parseProcedure)
+{
+    const auto callOut =
+        CallOut::parse("1. Priority: High, Procedure: BMCSP02");
+
+    EXPECT_EQ("H -BMCSP02      ", callOut.getLine1());
+    EXPECT_EQ("                ", callOut.getLine2());
+    EXPECT_FALSE(callOut.isBlank());
+}
+
+TEST(CallOut, parseHardware)
+{
+    const auto callOut = CallOut::parse("1. Location Code: "
+                                        "U78DA.ND0.1234567-P0-C15, "
+                                        "Priority: Medium, PN: SVCDOCS");
+
+    EXPECT_EQ("M -SVCDOCS      ", callOut.getLine1());
+    // Location code is truncated to the line length.
+    EXPECT_EQ("U78DA.ND0.123456", callOut.getLine2());
+}
+
+TEST(CallOut, parseInvalid)
+{
+    EXPECT_TRUE(CallOut::parse("").isBlank());
+    EXPECT_TRUE(CallOut::parse("1. Serial Number: 1234").isBlank());
+    EXPECT_TRUE(CallOut::parse("no properties").isBlank());
+}
+
+TEST(CallOut, parseResolution)
+{
+    std::string resolution;
+    for (char priority : std::string_view("HMLHMLH"))
+    {
+        resolution += "1. Priority: ";
+        resolution += priority;
+        resolution += ", PN: 01AB234\n";
+    }
+
+    const auto callOuts = CallOut::parseResolution(resolution);
+    ASSERT_EQ(CallOut::maxCallOuts, callOuts.size());
+    EXPECT_EQ("H -01AB234      ", callOuts[0].getLine1());
+    EXPECT_EQ("L -01AB234      ", callOuts[5].getLine1());
+
+    // A line without new line is not a complete callout.
+    EXPECT_TRUE(CallOut::parseResolution("1. Priority: High").empty());
+}
@@ -0,0 +1,80 @@
+#include "event_recorder.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+using namespace panel;
+using namespace panel::record;
+
+TEST(EventRecorder, payload)
+{
+    Payload payload;
+    payload << uint16_t{0x130} << int32_t{-1} << true
+            << std::string("BD8D1001") << types::Binary{0x20, 0x01};
+
+    Payload decoded(payload.data());
+    uint16_t code = 0;
+    int32_t value = 0;
+    bool flag = false;
+    std::string src;
+    types::Binary bytes;
+    decoded >> code >> value >> flag >> src >> bytes;
+
+    EXPECT_EQ(0x130, code);
+    EXPECT_EQ(-1, value);
+    EXPECT_TRUE(flag);
+    EXPECT_EQ("BD8D1001", src);
+    EXPECT_EQ((types::Binary{0x20, 0x01}), bytes);
+
+    // Nothing left to read.
+    EXPECT_THROW(decoded >> code, std::runtime_error);
+}
+
+TEST(EventRecorder, recordAndLoad)
+{
+    const std::string path = ::testing::TempDir() + "panel_recording";
+    {
+        Recorder recorder;
+        EXPECT_FALSE(recorder.isActive());
+
+        // Not started, nothing is written.
+        recorder.record(EventType::DISPLAY, std::string("ignored"));
+
+        recorder.start(path);
+        EXPECT_TRUE(recorder.isActive());
+        recorder.record(EventType::BMC_STATE,
+                        std::string("xyz.openbmc_project.State.BMC."
+                                    "BMCState.Ready"));
+        recorder.record(EventType::EXECUTE_FUNCTION, types::FunctionNumber{2});
+        recorder.record(EventType::GET_ENABLED_FUNCTIONS);
+    }
+
+    auto events = load(path);
+    ASSERT_EQ(3, events.size());
+
+    EXPECT_EQ(EventType::BMC_STATE, events[0].type);
+    std::string state;
+    events[0].payload >> state;
+    EXPECT_EQ("xyz.openbmc_project.State.BMC.BMCState.Ready", state);
+
+    EXPECT_EQ(EventType::EXECUTE_FUNCTION, events[1].type);
+    types::FunctionNumber funcNum = 0;
+    events[1].payload >> funcNum;
+    EXPECT_EQ(2, funcNum);
+    EXPECT_LE(events[0].timestamp, events[1].timestamp);
+
+    EXPECT_EQ(EventType::GET_ENABLED_FUNCTIONS, events[2].type);
+    EXPECT_TRUE(events[2].payload.data().empty());
+
+    // A record cut short by a crash is dropped.
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::app);
+        file.put(0x01);
+    }
+    EXPECT_EQ(3, load(path).size());
+
+    std::remove(path.c_str());
+    EXPECT_THROW(load(path), std::runtime_error);
+}
@@ -0,0 +1,55 @@
+#include "function_telemetry.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace panel;
+using namespace std::chrono_literals;
+
+TEST(FunctionTelemetry, countsAndPercentiles)
+{
+    FunctionTelemetry telemetry;
+    EXPECT_TRUE(telemetry.getStatistics().empty());
+
+    // 1 to 100 ms, the 100th execution failing.
+    for (int ms = 1; ms < 100; ++ms)
+    {
+        telemetry.record(42, std::chrono::milliseconds(ms));
+    }
+    telemetry.record(42, 100ms, "Failed to create dump");
+
+    const auto statistics = telemetry.getStatistics();
+    ASSERT_EQ(1, statistics.size());
+
+    const auto& [success, failure, p50, p99, max, lastError] =
+        statistics.at(42);
+    EXPECT_EQ(99, success);
+    EXPECT_EQ(1, failure);
+    EXPECT_EQ(50000, p50);
+    EXPECT_EQ(99000, p99);
+    EXPECT_EQ(100000, max);
+    EXPECT_EQ("Failed to create dump", lastError);
+}
+
+TEST(FunctionTelemetry, percentilesOfLatestExecutions)
+{
+    FunctionTelemetry telemetry;
+
+    // Slow executions pushed out by the later fast ones.
+    for (size_t count = 0; count < FunctionTelemetry::sampleCount; ++count)
+    {
+        telemetry.record(2, 1s);
+    }
+    for (size_t count = 0; count < FunctionTelemetry::sampleCount; ++count)
+    {
+        telemetry.record(2, 10us);
+    }
+
+    const auto& [success, failure, p50, p99, max, lastError] =
+        telemetry.getStatistics().at(2);
+    EXPECT_EQ(2 * FunctionTelemetry::sampleCount, success);
+    EXPECT_EQ(0, failure);
+    EXPECT_EQ(10, p50);
+    EXPECT_EQ(10, p99);
+    EXPECT_EQ(1000000, max);
+    EXPECT_TRUE(lastError.empty());
+}
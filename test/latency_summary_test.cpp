@@ -0,0 +1,56 @@
+#include "latency_summary.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace panel;
+using namespace std::chrono_literals;
+
+TEST(LatencySummary, percentiles)
+{
+    std::vector<uint32_t> samples;
+    for (uint32_t sample = 100; sample > 0; --sample)
+    {
+        samples.push_back(sample);
+    }
+
+    const auto summary = summarizeLatency(std::span(samples));
+    EXPECT_EQ(100, summary.count);
+    EXPECT_EQ(50, summary.mean);
+    EXPECT_EQ(1, summary.min);
+    EXPECT_EQ(50, summary.p50);
+    EXPECT_EQ(90, summary.p90);
+    EXPECT_EQ(99, summary.p99);
+    EXPECT_EQ(100, summary.max);
+}
+
+TEST(LatencySummary, fewSamples)
+{
+    std::vector<uint32_t> samples{10, 9, 8, 7, 6, 5, 4, 3, 2, 1};
+    const auto summary = summarizeLatency(std::span(samples));
+    EXPECT_EQ(1, summary.min);
+    EXPECT_EQ(5, summary.p50);
+    EXPECT_EQ(9, summary.p90);
+    EXPECT_EQ(10, summary.p99);
+    EXPECT_EQ(10, summary.max);
+
+    samples = {7};
+    EXPECT_EQ(7, summarizeLatency(std::span(samples)).p99);
+}
+
+TEST(LatencySummary, durations)
+{
+    std::vector<std::chrono::steady_clock::duration> samples{3ms, 1ms, 2ms};
+    const auto summary = summarizeLatency(std::span(samples));
+    EXPECT_EQ(3, summary.count);
+    EXPECT_EQ(2000, summary.mean);
+    EXPECT_EQ(1000, summary.min);
+    EXPECT_EQ(2000, summary.p50);
+    EXPECT_EQ(3000, summary.max);
+
+    samples.clear();
+    EXPECT_EQ(0, summarizeLatency(std::span(samples)).count);
+}
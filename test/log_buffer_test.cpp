@@ -0,0 +1,106 @@
+#include "log_buffer.hpp"
+
+#include "log_record.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Logger;
+
+namespace
+{
+/**
+ * @brief Split copied records in time and payload.
+ * @param[in] records - Records copied out of the ring.
+ * @param[in] snapshot - Time and length of the records.
+ * @return Time and payload of each record.
+ */
+std::vector<std::pair<uint64_t, std::string>>
+    splitRecords(const std::array<uint8_t, LogBuffer::capacity>& records,
+                 const LogBuffer::Snapshot& snapshot)
+{
+    // Values written by the tests fit in a byte.
+    std::vector<std::pair<uint64_t, std::string>> split;
+    auto time = snapshot.firstTimestamp;
+    for (size_t pos = 0; pos < snapshot.length;)
+    {
+        const size_t length = records[pos];
+        const auto delta = zigzagDecode(records[pos + 1]);
+        time += split.empty() ? 0 : static_cast<uint64_t>(delta);
+        split.emplace_back(time, std::string(records.begin() + pos + 2,
+                                             records.begin() + pos + 1 +
+                                                 length));
+        pos += 1 + length;
+    }
+    return split;
+}
+
+/**
+ * @brief Bytes of a string.
+ * @param[in] text - String.
+ * @return View of its bytes.
+ */
+std::span<const uint8_t> bytes(const std::string& text)
+{
+    return std::span(reinterpret_cast<const uint8_t*>(text.data()),
+                     text.size());
+}
+} // namespace
+
+TEST(LogBuffer, copyRecords)
+{
+    LogBuffer buffer;
+    std::array<uint8_t, LogBuffer::capacity> records;
+    EXPECT_EQ(0, buffer.copy(records).length);
+
+    buffer.write(1000, bytes("first"));
+    buffer.write(1010, bytes("second"));
+
+    // Wall clock stepped back.
+    buffer.write(990, bytes("third"));
+    buffer.write(1000, bytes("fourth"));
+
+    const auto split = splitRecords(records, buffer.copy(records));
+    ASSERT_EQ(4, split.size());
+    EXPECT_EQ(std::make_pair(uint64_t{1000}, std::string("first")),
+              split[0]);
+    EXPECT_EQ(std::make_pair(uint64_t{1010}, std::string("second")),
+              split[1]);
+    EXPECT_EQ(std::make_pair(uint64_t{990}, std::string("third")),
+              split[2]);
+    EXPECT_EQ(std::make_pair(uint64_t{1000}, std::string("fourth")),
+              split[3]);
+}
+
+TEST(LogBuffer, evictsOldest)
+{
+    LogBuffer buffer;
+    const std::string payload(100, 'x');
+    for (uint32_t count = 0; count < 1000; ++count)
+    {
+        buffer.write(1000 + count, bytes(payload + std::to_string(count)));
+    }
+
+    std::array<uint8_t, LogBuffer::capacity> records;
+    const auto split = splitRecords(records, buffer.copy(records));
+    ASSERT_FALSE(split.empty());
+    EXPECT_LT(split.size(), 1000);
+
+    // Records left are the latest ones, in order, with their time.
+    auto count = 1000 - split.size();
+    for (const auto& [time, data] : split)
+    {
+        EXPECT_EQ(1000 + count, time);
+        EXPECT_EQ(payload + std::to_string(count), data);
+        ++count;
+    }
+
+    // Payload longer than the limit is dropped.
+    buffer.write(5000, bytes(std::string(LogBuffer::maxPayloadLength + 1,
+                                         'y')));
+    EXPECT_EQ(payload + "999",
+              splitRecords(records, buffer.copy(records)).back().second);
+}
@@ -0,0 +1,88 @@
+#include "logger.hpp"
+
+#include <array>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Logger;
+
+TEST(Logger, formatMessage)
+{
+    std::array<char, 64> buffer;
+    const std::vector<uint8_t> packet{0x01, 0xAB, 0x0F};
+    const uint8_t function = 25;
+
+    EXPECT_EQ("Function 25 failed. rc = -1, done = false",
+              MessageWriter(buffer).format(
+                  "Function {} failed. rc = {}, done = {}", function, -1,
+                  false));
+    EXPECT_EQ("packet: 01 AB 0F, id 0x00C8",
+              MessageWriter(buffer).format("packet: {}, id 0x{}",
+                                           Bytes{packet}, Hex{200, 4}));
+    EXPECT_EQ("text and more {}",
+              MessageWriter(buffer).format("{} and {} {}",
+                                           std::string("text"), "more"));
+
+    // Output is truncated to the buffer.
+    std::array<char, 4> small;
+    EXPECT_EQ("abcd", MessageWriter(small).format("ab{}", "cdef"));
+}
+
+TEST(Logger, dumpAndDecode)
+{
+    const std::vector<uint8_t> packet{0x01, 0xAB};
+    log(Subsystem::EXECUTOR, Loglevel::INFO, "Function {} rc = {}, done = {}",
+        uint8_t{25}, -300, true);
+    log(Subsystem::PLDM, Loglevel::INFO, "packet: {}, id 0x{}, {}",
+        Bytes{packet}, Hex{200, 4}, std::string("text"));
+    log(Subsystem::PLDM, Loglevel::DEBUG, "Not logged");
+
+    const auto path = testing::TempDir() + "panellog.bin";
+    ASSERT_TRUE(dumpLogs(path));
+    std::ifstream file(path, std::ios::binary);
+    const std::vector<uint8_t> dump(std::istreambuf_iterator<char>(file), {});
+
+    const auto lines = decodeDump(dump);
+    ASSERT_LE(2, lines.size());
+    const auto& function = lines[lines.size() - 2];
+    EXPECT_NE(std::string::npos,
+              function.find("[INFO] executor : logger_test.cpp:"));
+    EXPECT_TRUE(function.ends_with(" - Function 25 rc = -300, done = true"));
+    EXPECT_TRUE(lines.back().ends_with(" - packet: 01 AB, id 0x00C8, text"));
+
+    EXPECT_THROW(decodeDump(std::vector<uint8_t>(sizeof(DumpHeader))),
+                 std::runtime_error);
+    EXPECT_THROW(decodeDump(std::span(dump).first(dump.size() - 1)),
+                 std::runtime_error);
+
+    // Records of sites past the site table are reported.
+    const DumpHeader dropped{dumpMagic, dumpVersion, 0, 0, 0, 3};
+    EXPECT_EQ(std::vector<std::string>{
+                  "3 records dropped, the log site table is full"},
+              decodeDump(std::span(reinterpret_cast<const uint8_t*>(&dropped),
+                                   sizeof(dropped))));
+}
+
+TEST(Logger, setLevels)
+{
+    EXPECT_EQ("info", getLevels().at("button"));
+    EXPECT_FALSE(isEnabled(Subsystem::BUTTON, Loglevel::DEBUG));
+
+    EXPECT_TRUE(setLevels({{"button", "debug"}, {"pldm", "error"}}));
+    EXPECT_TRUE(isEnabled(Subsystem::BUTTON, Loglevel::DEBUG));
+    EXPECT_FALSE(isEnabled(Subsystem::PLDM, Loglevel::INFO));
+    EXPECT_EQ("debug", getLevels().at("button"));
+
+    // Unknown names change nothing.
+    EXPECT_FALSE(setLevels({{"button", "info"}, {"unknown", "info"}}));
+    EXPECT_FALSE(setLevels({{"button", "verbose"}}));
+    EXPECT_EQ("debug", getLevels().at("button"));
+
+    setLevel(Subsystem::BUTTON, Loglevel::INFO);
+    setLevel(Subsystem::PLDM, Loglevel::INFO);
+}
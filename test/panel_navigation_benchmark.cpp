@@ -0,0 +1,126 @@
+#include "function_bitmap.hpp"
+#include "function_registry.hpp"
+#include "panel_state_manager.hpp"
+#include "transport.hpp"
+#include "types.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <sdbusplus/asio/connection.hpp>
+#include <sdbusplus/asio/object_server.hpp>
+
+using namespace panel::state::manager;
+using namespace panel::types;
+
+// Microbenchmark of panel function navigation and bulk enable/disable.
+// Reports average time per operation. The bitmap figures are the lookup of
+// the next enabled function alone, the button figures include rendering the
+// display and writing it to the panel.
+
+namespace
+{
+constexpr size_t iterations = 100000;
+
+/**
+ * @brief Step through the enabled functions, wrapping around like the panel.
+ * @param[in] enabled - Enabled functions.
+ * @param[in] current - Current function.
+ * @param[in] up - true to step to the next function, false to the previous.
+ * @return Function stepped to.
+ */
+FunctionNumber step(const panel::functions::FunctionBitmap& enabled,
+                    const FunctionNumber current, const bool up)
+{
+    const auto stepped = up ? enabled.next(current) : enabled.prev(current);
+    if (stepped)
+    {
+        return *stepped;
+    }
+    return up ? enabled.first().value_or(current)
+              : enabled.last().value_or(current);
+}
+
+template <typename Operation>
+void measure(const std::string& name, Operation&& operation)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t count = 0; count < iterations; ++count)
+    {
+        operation();
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    std::cout << name << ": " << (elapsed.count() / iterations) << " ns/op"
+              << std::endl;
+}
+} // namespace
+
+int main()
+{
+    auto io_con = std::make_shared<boost::asio::io_context>();
+    auto dummy_conn = std::make_shared<sdbusplus::asio::connection>(*io_con);
+    auto iface = std::make_shared<sdbusplus::asio::dbus_interface>(
+        dummy_conn, std::string{}, std::string{});
+
+    auto lcdPanel = std::make_shared<panel::Transport>();
+    auto executor =
+        std::make_shared<panel::Executor>(lcdPanel, dummy_conn, iface, io_con);
+
+    PanelStateManager stateMgr(lcdPanel, executor);
+
+    FunctionalityList allFunctions;
+    for (const auto& function : panel::functions::Registry::table)
+    {
+        allFunctions.push_back(function.number);
+    }
+
+    panel::functions::FunctionBitmap defaultEnabled;
+    panel::functions::FunctionBitmap allEnabled;
+    for (const auto& function : panel::functions::Registry::table)
+    {
+        allEnabled.set(function.number);
+        if (function.defaultEnabled)
+        {
+            defaultEnabled.set(function.number);
+        }
+    }
+
+    // Kept live so that the lookups are not optimized out.
+    volatile FunctionNumber current = 1;
+
+    // Only functions enabled by default, mostly disabled entries to skip.
+    measure("bitmap next (default)", [&defaultEnabled, &current]() {
+        current = step(defaultEnabled, current, true);
+    });
+    measure("bitmap prev (default)", [&defaultEnabled, &current]() {
+        current = step(defaultEnabled, current, false);
+    });
+    measure("bitmap next (all enabled)", [&allEnabled, &current]() {
+        current = step(allEnabled, current, true);
+    });
+    measure("bitmap prev (all enabled)", [&allEnabled, &current]() {
+        current = step(allEnabled, current, false);
+    });
+
+    measure("button increment (default)", [&stateMgr]() {
+        stateMgr.processPanelButtonEvent(ButtonEvent::INCREMENT);
+    });
+    measure("button decrement (default)", [&stateMgr]() {
+        stateMgr.processPanelButtonEvent(ButtonEvent::DECREMENT);
+    });
+
+    measure("enable all", [&stateMgr, &allFunctions]() {
+        stateMgr.enableFunctonality(allFunctions);
+    });
+
+    measure("button increment (all enabled)", [&stateMgr]() {
+        stateMgr.processPanelButtonEvent(ButtonEvent::INCREMENT);
+    });
+
+    measure("disable all", [&stateMgr, &allFunctions]() {
+        stateMgr.disableFunctonality(allFunctions);
+    });
+
+    return 0;
+}
@@ -1,3 +1,5 @@
+#include "bios_attributes.hpp"
+#include "function_bitmap.hpp"
 #include "panel_state_manager.hpp"
 #include "transport.hpp"
 #include "types.hpp"
@@ -13,8 +15,7 @@ using namespace panel::types;
 using namespace std;
 
 // These test cases makes a presumption about the default value into the state
-// manager via FunctionalityAttributes initialization in
-// panel_state_manager.cpp.
+// manager via the function registry in function_registry.hpp.
 // If values are changed there, modify the test cases accordingly.
 
 // NOTE: Using "up", "down" and "enter" till we implement actual button events.
@@ -25,7 +26,8 @@ auto iface = std::make_shared<sdbusplus::asio::dbus_interface>(
     dummy_conn, std::string{}, std::string{});
 
 auto lcdPanel = std::make_shared<panel::Transport>();
-auto executor = std::make_shared<panel::Executor>(lcdPanel, iface, io_con);
+auto executor =
+    std::make_shared<panel::Executor>(lcdPanel, dummy_conn, iface, io_con);
 
 TEST(PanelStateManager, default_state)
 {
@@ -115,3 +117,135 @@ TEST(PanelStateManager, enter_traverse_sub_range)
     EXPECT_EQ(64, get<0>(panelStateInfo));
     EXPECT_EQ(0, get<1>(panelStateInfo));
 }
+
+TEST(PanelStateManager, enable_disable_traverse)
+{
+    PanelStateManager stateMgr(lcdPanel, executor);
+    stateMgr.enableFunctonality(FunctionalityList{11, 12});
+
+    stateMgr.processPanelButtonEvent(ButtonEvent::INCREMENT); // 2
+    stateMgr.processPanelButtonEvent(ButtonEvent::INCREMENT); // 4
+    stateMgr.processPanelButtonEvent(ButtonEvent::INCREMENT);
+    tuple<size_t, size_t> panelStateInfo = stateMgr.getPanelCurrentStateInfo();
+    EXPECT_EQ(11, get<0>(panelStateInfo));
+
+    stateMgr.disableFunctonality(FunctionalityList{12});
+    stateMgr.processPanelButtonEvent(ButtonEvent::INCREMENT);
+    panelStateInfo = stateMgr.getPanelCurrentStateInfo();
+    EXPECT_EQ(20, get<0>(panelStateInfo));
+
+    stateMgr.processPanelButtonEvent(ButtonEvent::DECREMENT);
+    panelStateInfo = stateMgr.getPanelCurrentStateInfo();
+    EXPECT_EQ(11, get<0>(panelStateInfo));
+}
+
+TEST(FunctionBitmap, next_prev)
+{
+    panel::functions::FunctionBitmap bitmap;
+    EXPECT_FALSE(bitmap.first().has_value());
+    EXPECT_FALSE(bitmap.last().has_value());
+
+    bitmap.set(1);
+    bitmap.set(63);
+    bitmap.set(64);
+    bitmap.set(127);
+    EXPECT_EQ(4, bitmap.count());
+    EXPECT_EQ(1, bitmap.first().value());
+    EXPECT_EQ(127, bitmap.last().value());
+
+    // Search crosses the 64 bit word boundary.
+    EXPECT_EQ(63, bitmap.next(1).value());
+    EXPECT_EQ(64, bitmap.next(63).value());
+    EXPECT_EQ(127, bitmap.next(64).value());
+    EXPECT_FALSE(bitmap.next(127).has_value());
+
+    EXPECT_EQ(64, bitmap.prev(127).value());
+    EXPECT_EQ(63, bitmap.prev(64).value());
+    EXPECT_EQ(1, bitmap.prev(63).value());
+    EXPECT_FALSE(bitmap.prev(1).has_value());
+
+    bitmap.reset(64);
+    EXPECT_FALSE(bitmap.test(64));
+    EXPECT_EQ(127, bitmap.next(63).value());
+}
+
+TEST(PanelStateManager, current_function_disabled)
+{
+    PanelStateManager stateMgr(lcdPanel, executor);
+    stateMgr.processPanelButtonEvent(ButtonEvent::DECREMENT);
+    tuple<size_t, size_t> panelStateInfo = stateMgr.getPanelCurrentStateInfo();
+    EXPECT_EQ(64, get<0>(panelStateInfo));
+
+    // Function 64 needs CE mode, panel moves back to function 01.
+    stateMgr.setSystemOperatingMode("Manual");
+    panelStateInfo = stateMgr.getPanelCurrentStateInfo();
+    EXPECT_EQ(1, get<0>(panelStateInfo));
+    EXPECT_EQ(0, get<1>(panelStateInfo));
+
+    stateMgr.processPanelButtonEvent(ButtonEvent::DECREMENT);
+    panelStateInfo = stateMgr.getPanelCurrentStateInfo();
+    EXPECT_EQ(43, get<0>(panelStateInfo));
+}
+
+TEST(PanelStateManager, navigation_offset)
+{
+    PanelStateManager stateMgr(lcdPanel, executor);
+    stateMgr.processPanelNavigation(3); // 2, 4, 20
+    tuple<size_t, size_t> panelStateInfo = stateMgr.getPanelCurrentStateInfo();
+    EXPECT_EQ(20, get<0>(panelStateInfo));
+    EXPECT_EQ(0, get<1>(panelStateInfo));
+
+    stateMgr.processPanelNavigation(-4); // 4, 2, 1, 64
+    panelStateInfo = stateMgr.getPanelCurrentStateInfo();
+    EXPECT_EQ(64, get<0>(panelStateInfo));
+
+    stateMgr.processPanelNavigation(0);
+    panelStateInfo = stateMgr.getPanelCurrentStateInfo();
+    EXPECT_EQ(64, get<0>(panelStateInfo));
+}
+
+TEST(PanelStateManager, ipl_parameters_in_progress)
+{
+    // Current IPL parameters, as read from BaseBIOSTable.
+    const auto attribute = [](const std::string& name,
+                              const std::string& value) {
+        return BiosBaseTableItem{name,
+                                 BiosProperty{"", false, "", "", "", value,
+                                              value, {}}};
+    };
+    panel::bios::attributes().update(std::vector<BiosBaseTableItem>{
+        attribute("pvm_os_boot_type", "A_Mode"),
+        attribute("pvm_system_operating_mode", "Manual"),
+        attribute("fw_boot_side", "Perm")});
+
+    // Job is held, so that the BIOS write never reaches the D-Bus.
+    auto jobExecutor =
+        std::make_shared<panel::Executor>(lcdPanel, dummy_conn, iface, io_con);
+    panel::Executor::JobDone jobDone;
+    jobExecutor->setJobStarter(
+        [&jobDone](FunctionNumber, panel::Executor::Job,
+                   panel::Executor::JobDone done) {
+            jobDone = std::move(done);
+        });
+
+    PanelStateManager stateMgr(lcdPanel, jobExecutor);
+    stateMgr.processPanelButtonEvent(ButtonEvent::INCREMENT);
+    EXPECT_EQ(2, get<0>(stateMgr.getPanelCurrentStateInfo()));
+
+    // Select IPL type B, keep the other parameters and execute.
+    stateMgr.processPanelButtonEvent(ButtonEvent::EXECUTE);
+    stateMgr.processPanelButtonEvent(ButtonEvent::INCREMENT);
+    stateMgr.processPanelButtonEvent(ButtonEvent::EXECUTE);
+    stateMgr.processPanelButtonEvent(ButtonEvent::EXECUTE);
+    stateMgr.processPanelButtonEvent(ButtonEvent::EXECUTE);
+
+    // BIOS write is pending, the job frame is on top of the page.
+    ASSERT_TRUE(jobExecutor->isJobRunning(2));
+    ASSERT_TRUE(jobDone);
+    const auto& frame = jobExecutor->getRenderer().getFrame();
+    EXPECT_EQ("02", frame.line1.substr(0, 2));
+    EXPECT_EQ("IN PROGRESS", frame.line2);
+
+    jobDone(true);
+    EXPECT_FALSE(jobExecutor->isJobRunning(2));
+}
@@ -0,0 +1,84 @@
+#include "progress_code.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace panel;
+
+// Microbenchmark of progress code decoding, against the stream based
+// formatting it replaced. Reports average time per progress code.
+
+namespace
+{
+constexpr size_t iterations = 100000;
+
+template <typename Operation>
+void measure(const std::string& name, Operation&& operation)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t count = 0; count < iterations; ++count)
+    {
+        operation();
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    std::cout << name << ": " << (elapsed.count() / iterations) << " ns/op"
+              << std::endl;
+}
+} // namespace
+
+int main()
+{
+    constexpr uint64_t src = 0x3139303430303743; // C7004091
+    std::vector<types::Byte> hexWordData(progress_code::hexWordDataLength,
+                                         0x20);
+    hexWordData[0] = 0x02;
+    hexWordData[3] = 0x09;
+    for (size_t pos = progress_code::hexWordOffset; pos < 40; ++pos)
+    {
+        hexWordData[pos] = static_cast<types::Byte>(pos * 7);
+    }
+
+    size_t sink = 0;
+
+    measure("stream decode", [&]() {
+        std::vector<types::Byte> byteArray;
+        byteArray.reserve(sizeof(src));
+        for (size_t i = 0; i < sizeof(src); i++)
+        {
+            byteArray.emplace_back(types::Byte(src >> (8 * i)) & 0xFF);
+        }
+        std::string hexWordsWithSRC(byteArray.begin(), byteArray.end());
+
+        std::ostringstream convert;
+        for (size_t word = 0; word < 8; ++word)
+        {
+            convert.str("");
+            hexWordsWithSRC += " ";
+            for (size_t byte = 0; byte < 4; ++byte)
+            {
+                convert << std::setfill('0') << std::setw(2) << std::hex
+                        << std::uppercase
+                        << static_cast<int>(
+                               hexWordData[progress_code::hexWordOffset +
+                                           4 * word + byte]);
+            }
+            hexWordsWithSRC += convert.str();
+        }
+        sink += hexWordsWithSRC.size();
+    });
+
+    measure("table decode", [&]() {
+        auto srcRecord = progress_code::decodeSrc(src);
+        progress_code::decodeHexWords(hexWordData, srcRecord);
+        SrcRecord::TextBuffer text;
+        sink += srcRecord.toText(text).size();
+    });
+
+    return sink == 0 ? 1 : 0;
+}
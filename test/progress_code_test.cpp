@@ -0,0 +1,86 @@
+#include "progress_code.hpp"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace panel;
+
+namespace
+{
+/**
+ * @brief Progress code holding an SRC.
+ * @param[in] src - 8 character SRC.
+ * @return Progress code, first character in the least significant byte.
+ */
+uint64_t toProgressCode(const std::string& src)
+{
+    uint64_t code = 0;
+    for (size_t pos = 0; pos < 8; ++pos)
+    {
+        code |= uint64_t{static_cast<uint8_t>(src[pos])} << (8 * pos);
+    }
+    return code;
+}
+
+/**
+ * @brief Format a progress code and its hexword data.
+ * @param[in] src - Progress code.
+ * @param[in] hexWordData - Hexword data.
+ * @return SRC followed by the hexwords, as stored for functions 11 to 13.
+ */
+std::string decode(const uint64_t src, const types::Binary& hexWordData)
+{
+    auto srcRecord = progress_code::decodeSrc(src);
+    if (progress_code::hasHexWords(hexWordData))
+    {
+        progress_code::decodeHexWords(hexWordData, srcRecord);
+    }
+    SrcRecord::TextBuffer text;
+    return std::string(srcRecord.toText(text));
+}
+
+// Hexword data sent down by PHYP with progress code C7004091, captured on a
+// system IPL.
+const types::Binary hostIplData = {
+    0x02, 0x01, 0x00, 0x09, 0x00, 0x00, 0x00, 0x48, 0x00, 0x02, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x20, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x37, 0x30, 0x30,
+    0x34, 0x30, 0x39, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20};
+
+// Hexword data of a progress code without hexwords.
+const types::Binary noHexWordData(progress_code::hexWordDataLength, 0x20);
+} // namespace
+
+TEST(ProgressCode, decodeSrc)
+{
+    EXPECT_EQ("C1001F00",
+              progress_code::decodeSrc(toProgressCode("C1001F00")).getSrc());
+    EXPECT_EQ("C7004091",
+              progress_code::decodeSrc(0x3139303430303743).getSrc());
+}
+
+TEST(ProgressCode, golden)
+{
+    EXPECT_EQ("C7004091 00020030 00000000 2E200010 00000000 00000000 "
+              "00000000 00000000 00000000",
+              decode(toProgressCode("C7004091"), hostIplData));
+
+    EXPECT_FALSE(progress_code::hasHexWords(noHexWordData));
+    EXPECT_EQ("C1001F00", decode(toProgressCode("C1001F00"), noHexWordData));
+
+    // Only the valid words are decoded.
+    auto twoWords = hostIplData;
+    twoWords[3] = 0x03;
+    EXPECT_EQ("C7004091 00020030 00000000",
+              decode(toProgressCode("C7004091"), twoWords));
+
+    // Count beyond the SRC hexwords is capped.
+    auto badCount = hostIplData;
+    badCount[3] = 0xFF;
+    EXPECT_EQ(SrcRecord::maxTextLength,
+              decode(toProgressCode("C7004091"), badCount).size());
+}
@@ -0,0 +1,91 @@
+#include "progress_timeline.hpp"
+
+#include <cstdio>
+
+#include "gtest/gtest.h"
+
+using namespace panel;
+using namespace panel::timeline;
+using namespace std::chrono_literals;
+
+TEST(ProgressTimeline, keptAcrossRestart)
+{
+    const std::string path = ::testing::TempDir() + "panel_timeline";
+    std::remove(path.c_str());
+
+    {
+        Timeline timeline;
+        // Codes before the file is opened are not written to it.
+        timeline.append(SrcRecord::fromSrc("C1001F00"), 1s);
+
+        ASSERT_TRUE(timeline.open(path));
+        EXPECT_EQ(0, timeline.size());
+
+        auto srcRecord = SrcRecord::fromSrc("C1001F00");
+        srcRecord.hexWords[0] = 0x20;
+        srcRecord.hexWordCount = 1;
+        timeline.append(srcRecord, 10s);
+        timeline.append(SrcRecord::fromSrc("C1001F0D"), 12s);
+    }
+
+    Timeline timeline;
+    ASSERT_TRUE(timeline.open(path, true));
+    ASSERT_EQ(2, timeline.size());
+
+    const auto first = timeline.at(0);
+    EXPECT_EQ("C1001F00", first.toSrcRecord().getSrc());
+    EXPECT_EQ(1, first.hexWordCount);
+    EXPECT_EQ(0x20, first.hexWords[0]);
+    EXPECT_EQ(std::chrono::nanoseconds(10s).count(), first.timestamp);
+    EXPECT_EQ(timeline.currentBoot(), first.boot);
+    EXPECT_EQ("C1001F0D", timeline.at(1).toSrcRecord().getSrc());
+    EXPECT_THROW(timeline.at(2), std::out_of_range);
+
+    std::remove(path.c_str());
+    EXPECT_FALSE(timeline.open(path, true));
+}
+
+TEST(ProgressTimeline, bootsAndWrap)
+{
+    Timeline timeline;
+    const auto firstBoot = timeline.currentBoot();
+
+    timeline.append(SrcRecord::fromSrc("C1001F00"), 5s);
+    timeline.startBoot();
+    timeline.append(SrcRecord::fromSrc("C1001F00"), 6s);
+
+    // Monotonic clock going back means the BMC rebooted.
+    timeline.append(SrcRecord::fromSrc("C1001F00"), 1s);
+
+    EXPECT_EQ(firstBoot, timeline.at(0).boot);
+    EXPECT_EQ(firstBoot + 1, timeline.at(1).boot);
+    EXPECT_EQ(firstBoot + 2, timeline.at(2).boot);
+
+    // Oldest codes are overwritten once full.
+    for (uint32_t count = 0; count < Timeline::capacity; ++count)
+    {
+        timeline.append(SrcRecord::fromSrc("C7004091"),
+                        2s + std::chrono::milliseconds(count));
+    }
+    EXPECT_EQ(Timeline::capacity, timeline.size());
+    EXPECT_EQ(std::chrono::nanoseconds(2s).count(), timeline.at(0).timestamp);
+}
+
+TEST(ProgressTimeline, bmcReboot)
+{
+    const BootId firstBmcBoot{"0f8b1c2e-5d1a-4c7e-9a43-1b2f6e0d7c11"};
+    const BootId secondBmcBoot{"7e3d9a60-2b4f-4f1e-8c5d-6a9b0c1d2e3f"};
+
+    Timeline timeline;
+    const auto firstBoot = timeline.currentBoot();
+    timeline.append(SrcRecord::fromSrc("C1001F00"), 5s, firstBmcBoot);
+    timeline.append(SrcRecord::fromSrc("C1001F0D"), 6s, firstBmcBoot);
+
+    // The BMC rebooted, its clock is past the last code all the same.
+    timeline.append(SrcRecord::fromSrc("C1001F00"), 9s, secondBmcBoot);
+    timeline.append(SrcRecord::fromSrc("C1001F0D"), 10s, secondBmcBoot);
+
+    EXPECT_EQ(firstBoot, timeline.at(1).boot);
+    EXPECT_EQ(firstBoot + 1, timeline.at(2).boot);
+    EXPECT_EQ(firstBoot + 1, timeline.at(3).boot);
+}
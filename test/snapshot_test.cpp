@@ -0,0 +1,115 @@
+#include "snapshot.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+using namespace panel;
+using namespace panel::snapshot;
+
+namespace
+{
+PanelState makeState(const std::string& src)
+{
+    PanelState state;
+    state.pelSrcs.push(SrcRecord::fromEventId("BD8D1001 00000055 00000000"));
+    state.pelSrcs.push(SrcRecord::fromSrc(src));
+    state.latestSrc = SrcRecord::fromEventId(src + " 00000055");
+    state.callOutList = CallOut::parseResolution(
+        "1. Priority: High, Location Code: U78DA.ND0\n");
+    state.systemState = 0x12;
+    state.currentFunction = 30;
+    return state;
+}
+} // namespace
+
+TEST(Snapshot, saveAndLoad)
+{
+    const std::string path = ::testing::TempDir() + "panel_snapshot";
+    std::remove(path.c_str());
+
+    {
+        Store store;
+        ASSERT_TRUE(store.open(path));
+
+        // Nothing saved yet.
+        EXPECT_FALSE(store.load().has_value());
+
+        store.save(makeState("C1001F01"));
+    }
+
+    Store store;
+    ASSERT_TRUE(store.open(path));
+    const auto state = store.load();
+    ASSERT_TRUE(state.has_value());
+
+    const auto expected = makeState("C1001F01");
+    ASSERT_EQ(2, state->pelSrcs.size());
+    EXPECT_EQ("BD8D1001", state->pelSrcs.at(0).getSrc());
+    EXPECT_EQ(2, state->pelSrcs.at(0).hexWordCount);
+    EXPECT_EQ(0x55, state->pelSrcs.at(0).hexWords[0]);
+    EXPECT_EQ("C1001F01", state->pelSrcs.at(1).getSrc());
+    ASSERT_TRUE(state->latestSrc.has_value());
+    EXPECT_EQ("C1001F01", state->latestSrc->getSrc());
+    ASSERT_EQ(1, state->latestSrc->hexWordCount);
+    EXPECT_EQ(0x55, state->latestSrc->hexWords[0]);
+    ASSERT_EQ(1, state->callOutList.size());
+    EXPECT_EQ(expected.callOutList[0].line1, state->callOutList[0].line1);
+    EXPECT_EQ(expected.callOutList[0].line2, state->callOutList[0].line2);
+    EXPECT_EQ(expected.systemState, state->systemState);
+    EXPECT_EQ(expected.currentFunction, state->currentFunction);
+
+    std::remove(path.c_str());
+}
+
+TEST(Snapshot, tornWriteKeepsPreviousSnapshot)
+{
+    const std::string path = ::testing::TempDir() + "panel_snapshot";
+    std::remove(path.c_str());
+
+    {
+        Store store;
+        ASSERT_TRUE(store.open(path));
+        // First save goes to slot 1, the second to slot 0.
+        store.save(makeState("C1001F01"));
+        store.save(makeState("C1001F02"));
+        EXPECT_EQ("C1001F02", store.load()->pelSrcs.back().getSrc());
+    }
+
+    {
+        // Corrupt the data of slot 0, after the 16 byte file header and 16
+        // byte slot header.
+        std::fstream file(path,
+                          std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(32);
+        file.put(0x7F);
+    }
+
+    Store store;
+    ASSERT_TRUE(store.open(path));
+    const auto state = store.load();
+    ASSERT_TRUE(state.has_value());
+    EXPECT_EQ("C1001F01", state->pelSrcs.back().getSrc());
+
+    // Next save replaces the corrupt slot.
+    store.save(makeState("C1001F03"));
+    EXPECT_EQ("C1001F03", store.load()->pelSrcs.back().getSrc());
+
+    std::remove(path.c_str());
+}
+
+TEST(Snapshot, foreignFileIsReset)
+{
+    const std::string path = ::testing::TempDir() + "panel_snapshot";
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "not a panel snapshot";
+    }
+
+    Store store;
+    ASSERT_TRUE(store.open(path));
+    EXPECT_FALSE(store.load().has_value());
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,67 @@
+#include "src_record.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace panel;
+
+TEST(RingBuffer, keepsLatestItems)
+{
+    RingBuffer<int, 3> ring;
+    EXPECT_TRUE(ring.empty());
+    EXPECT_THROW(ring.at(0), std::out_of_range);
+
+    for (int item = 1; item <= 5; ++item)
+    {
+        ring.push(item);
+    }
+
+    ASSERT_EQ(3, ring.size());
+    EXPECT_EQ(3, ring.at(0));
+    EXPECT_EQ(4, ring.at(1));
+    EXPECT_EQ(5, ring.at(2));
+    EXPECT_EQ(5, ring.back());
+    EXPECT_THROW(ring.at(3), std::out_of_range);
+
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+    ring.push(6);
+    EXPECT_EQ(6, ring.at(0));
+}
+
+TEST(SrcRecord, fromEventId)
+{
+    const auto record = SrcRecord::fromEventId(
+        "BD8D1001 00000055 00000000 2E2D0010 A0000000 00000000 00000000 "
+        "00000000 0000FFFF");
+
+    EXPECT_EQ("BD8D1001", record.getSrc());
+    ASSERT_EQ(8, record.hexWordCount);
+    EXPECT_EQ(0x55, record.hexWords[0]);
+    EXPECT_EQ(0x2E2D0010, record.hexWords[2]);
+    EXPECT_EQ(0xA0000000, record.hexWords[3]);
+    EXPECT_EQ(0xFFFF, record.hexWords[7]);
+
+    // Parsing stops at a bad hexword.
+    const auto partial = SrcRecord::fromEventId("B1818611 0000000A 1234XYZW");
+    EXPECT_EQ("B1818611", partial.getSrc());
+    ASSERT_EQ(1, partial.hexWordCount);
+    EXPECT_EQ(0xA, partial.hexWords[0]);
+
+    // Short SRC is padded.
+    EXPECT_EQ("C100    ", SrcRecord::fromSrc("C100").getSrc());
+}
+
+TEST(SrcRecord, toHexWordLine)
+{
+    const auto record = SrcRecord::fromEventId(
+        "BD8D1001 00000055 00000000 2e2d0010 A0000000 0000FFFF");
+
+    SrcRecord::HexWordLine line;
+    EXPECT_EQ("0000005500000000", record.toHexWordLine(0, line));
+    EXPECT_EQ("2E2D0010A0000000", record.toHexWordLine(2, line));
+
+    // Hexwords the record does not have are blank.
+    EXPECT_EQ("0000FFFF        ", record.toHexWordLine(4, line));
+    EXPECT_EQ("                ", record.toHexWordLine(6, line));
+    EXPECT_EQ("                ", SrcRecord{}.toHexWordLine(0, line));
+}
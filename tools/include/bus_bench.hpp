@@ -0,0 +1,72 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace panel
+{
+namespace tool
+{
+
+/** @brief Methods of com.ibm.panel called by the benchmark. */
+enum class BenchMethod
+{
+    DISPLAY,
+    PROCESS_BUTTON,
+    GET_ENABLED_FUNCTIONS,
+    EXECUTE_FUNCTION
+};
+
+/** @brief Parameters of a benchmark run. */
+struct BenchConfig
+{
+    // Methods called in turn.
+    std::vector<BenchMethod> methods;
+
+    // Number of calls, over all the workers.
+    uint32_t calls = 1000;
+
+    // Calls started per second, over all the workers. 0 for no limit.
+    uint32_t rate = 0;
+
+    // Number of workers, each calling over its own bus connection.
+    uint32_t concurrency = 1;
+
+    // Function executed by ExecuteFunction, one PHYP executes.
+    types::FunctionNumber function = 21;
+
+    // D-Bus address of a private bus, the system bus if empty.
+    std::string address;
+};
+
+/**
+ * @brief Api to parse the methods to benchmark.
+ * @param[in] list - Comma separated method names, e.g.
+ *                   "Display,getEnabledFunctions", or "all".
+ * @return Methods, in the order given.
+ * @throw std::runtime_error on an unknown method name.
+ */
+std::vector<BenchMethod> parseBenchMethods(const std::string& list);
+
+/**
+ * @brief Api to benchmark the com.ibm.panel D-Bus methods.
+ *
+ * Workers take the calls in turn, calling the methods round robin, and
+ * wait for each reply. With a rate, each call starts at its scheduled time
+ * and is not delayed by slow replies of other workers. ProcessButton
+ * alternates UP and DOWN over all the workers, the presses left over are
+ * undone once the run ends so that the panel ends where it started.
+ * Prints the throughput, then the failed calls and the round trip latency
+ * distribution of each method.
+ *
+ * @param[in] config - Parameters of the run.
+ * @throw std::runtime_error if a worker can't connect to the bus, or if the
+ *        function to execute is not enabled for remote execution.
+ */
+void runBench(const BenchConfig& config);
+
+} // namespace tool
+} // namespace panel
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <chrono>
+#include <istream>
+#include <sdbusplus/bus.hpp>
+#include <vector>
+
+namespace panel
+{
+namespace tool
+{
+
+/**
+ * @brief Api to parse a script of button events.
+ *
+ * Events are separated by white space, each UP, DOWN or EXECUTE optionally
+ * followed by a repeat count, e.g. "UP*5 EXECUTE DOWN". A '#' starts a
+ * comment till the end of the line.
+ *
+ * @param[in] script - Script to parse.
+ * @return Button events in order, repeats expanded.
+ * @throw std::runtime_error on an invalid event or repeat count.
+ */
+std::vector<types::ButtonEvent> parseButtonScript(std::istream& script);
+
+/**
+ * @brief Api to send a script of button events to the panel app.
+ *
+ * Events are sent over the given bus connection, each waiting for the
+ * reply of the previous one. Prints the round trip latency distribution of
+ * the calls.
+ *
+ * @param[in] bus - Bus connection, reused for every event.
+ * @param[in] events - Button events to send.
+ * @param[in] wait - Time to wait between events.
+ */
+void runButtonScript(sdbusplus::bus_t& bus,
+                     const std::vector<types::ButtonEvent>& events,
+                     const std::chrono::milliseconds wait);
+
+} // namespace tool
+} // namespace panel
@@ -1,19 +1,58 @@
 #pragma once
 
+#include "types.hpp"
+
+#include <sdbusplus/bus.hpp>
 #include <string>
+
 namespace panel
 {
 namespace tool
 {
 
 /**
- * @brief Api to handle input events.
- * This api receives input event and call dbus api to process button event
- * accordingly.
+ * @brief Api to connect to the bus of the panel app.
+ * @param[in] address: D-Bus address of a private bus, e.g. of a panel app
+ *                     run with an emulated panel. System bus if empty.
+ * @return Bus connection.
+ * @throw std::runtime_error if the bus can't be connected to.
+ */
+sdbusplus::bus_t openBus(const std::string& address);
+
+/**
+ * @brief Api to convert an input event to a button event.
  * @param[in] input: Input event.
  *                   It can have values UP/DOWN or EXECUTE.
+ * @return Button event.
+ * @throw std::runtime_error on any other input.
+ */
+types::ButtonEvent toButtonEvent(const std::string& input);
+
+/**
+ * @brief Api to handle input events.
+ * This api calls dbus api to process the button event, waiting for its
+ * reply.
+ * @param[in] bus: Bus connection.
+ * @param[in] event: Button event.
+ */
+void btnEventDbusCall(sdbusplus::bus_t& bus, const types::ButtonEvent event);
+
+/**
+ * @brief Api to print the function telemetry of the panel app.
+ * Prints a table of execution counts, latency percentiles and last error of
+ * each executed panel function, followed by the progress codes received and
+ * displayed in the boot.
+ * @param[in] bus: Bus connection.
+ */
+void printFunctionTelemetry(sdbusplus::bus_t& bus);
+
+/**
+ * @brief Api to dump the logs of the panel app.
+ * The panel app writes its log buffer, binary, to a file.
+ * @param[in] bus: Bus connection.
+ * @return Path of the dump.
  */
-void btnEventDbusCall(const std::string& input);
+std::string dumpLogsDbusCall(sdbusplus::bus_t& bus);
 
 } // namespace tool
 } // namespace panel
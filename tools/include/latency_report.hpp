@@ -0,0 +1,39 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace panel
+{
+namespace tool
+{
+
+/** @brief Round trip latency of each call of a D-Bus method. */
+using LatencySamples = std::vector<std::chrono::microseconds>;
+
+/** @brief Calls made to a D-Bus method. */
+struct MethodCalls
+{
+    // Name of the method.
+    std::string method;
+
+    // Latency of the successful calls.
+    LatencySamples samples;
+
+    // Number of failed calls.
+    uint32_t failures = 0;
+};
+
+/**
+ * @brief Api to print the round trip latency distribution of D-Bus calls.
+ * Prints a row per method with its number of successful and failed calls,
+ * then the mean, min, p50, p90, p99 and max latency.
+ *
+ * @param[in] methods - Calls of each method.
+ */
+void printLatencyReport(std::vector<MethodCalls> methods);
+
+} // namespace tool
+} // namespace panel
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+
+namespace panel
+{
+namespace tool
+{
+
+/**
+ * @brief Api to print a log dump of the panel app as text.
+ *
+ * Decodes the binary records of the dump with the site table it holds,
+ * printing a line per record, oldest first.
+ *
+ * @param[in] path - Log dump file path.
+ */
+void printLogDump(const std::string& path);
+
+} // namespace tool
+} // namespace panel
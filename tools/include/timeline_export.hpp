@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace panel
+{
+namespace tool
+{
+
+/**
+ * @brief Api to export the progress code timeline of a boot.
+ *
+ * Prints, in CSV, each progress code of the boot with its time since the
+ * first code of the boot and the duration of its phase, i.e. the time till
+ * the next code. Phase of the last code has no duration yet.
+ *
+ * @param[in] path - Timeline file path.
+ * @param[in] boot - Boot to export, latest boot if not given.
+ */
+void exportBootTimeline(const std::string& path,
+                        const std::optional<uint32_t>& boot);
+
+} // namespace tool
+} // namespace panel
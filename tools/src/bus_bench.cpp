@@ -0,0 +1,281 @@
+#include "bus_bench.hpp"
+
+#include "dbus_call.hpp"
+#include "latency_report.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace panel
+{
+namespace tool
+{
+namespace
+{
+/* Names of the methods, indexed by BenchMethod */
+constexpr std::array<const char*, 4> methodNames = {
+    "Display", "ProcessButton", "getEnabledFunctions", "ExecuteFunction"};
+
+/** @brief Calls made by a worker. */
+struct WorkerResult
+{
+    // Latency of the successful calls, indexed by BenchMethod.
+    std::array<LatencySamples, methodNames.size()> samples;
+
+    // Number of failed calls, indexed by BenchMethod.
+    std::array<uint32_t, methodNames.size()> failures{};
+
+    // Set if the worker could not run.
+    std::exception_ptr error;
+};
+
+/** @brief ProcessButton presses, over all the workers. */
+struct ButtonPresses
+{
+    // Presses made, even ones go UP and odd ones DOWN.
+    std::atomic<uint32_t> count{0};
+
+    // UP presses the panel took less DOWN presses.
+    std::atomic<int32_t> offset{0};
+};
+
+/**
+ * @brief Api to call a method and wait for its reply.
+ * @param[in] bus - Bus connection of the worker.
+ * @param[in] method - Method to call.
+ * @param[in] call - Number of the call, over all the workers.
+ * @param[in] config - Parameters of the run.
+ * @param[in,out] presses - ProcessButton presses of the run.
+ */
+void callMethod(sdbusplus::bus_t& bus, const BenchMethod method,
+                const uint32_t call, const BenchConfig& config,
+                ButtonPresses& presses)
+{
+    auto request =
+        bus.new_method_call("com.ibm.PanelApp", "/com/ibm/panel_app",
+                            "com.ibm.panel",
+                            methodNames[static_cast<size_t>(method)]);
+    switch (method)
+    {
+        case BenchMethod::DISPLAY:
+            request.append(std::string("PANEL BENCH"), std::to_string(call));
+            bus.call(request);
+            break;
+        case BenchMethod::PROCESS_BUTTON:
+        {
+            const bool up = (presses.count++ % 2) == 0;
+            request.append(static_cast<int>(
+                up ? types::ButtonEvent::INCREMENT
+                   : types::ButtonEvent::DECREMENT));
+            bus.call(request);
+            presses.offset += up ? 1 : -1;
+            break;
+        }
+        case BenchMethod::GET_ENABLED_FUNCTIONS:
+        {
+            types::Binary functions;
+            auto reply = bus.call(request);
+            reply.read(functions);
+            break;
+        }
+        case BenchMethod::EXECUTE_FUNCTION:
+        {
+            types::ReturnStatus status;
+            request.append(config.function);
+            auto reply = bus.call(request);
+            reply.read(status);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Api to check that the panel app executes the function remotely.
+ * @param[in] config - Parameters of the run.
+ * @throw std::runtime_error if the function is not enabled.
+ */
+void checkFunctionEnabled(const BenchConfig& config)
+{
+    auto bus = openBus(config.address);
+    auto request = bus.new_method_call(
+        "com.ibm.PanelApp", "/com/ibm/panel_app", "com.ibm.panel",
+        methodNames[static_cast<size_t>(BenchMethod::GET_ENABLED_FUNCTIONS)]);
+    types::Binary functions;
+    bus.call(request).read(functions);
+
+    if (std::find(functions.begin(), functions.end(), config.function) ==
+        functions.end())
+    {
+        std::ostringstream enabled;
+        for (const auto function : functions)
+        {
+            enabled << " " << static_cast<int>(function);
+        }
+        throw std::runtime_error(
+            "Function " + std::to_string(config.function) +
+            " can't be executed remotely, enabled functions:" +
+            (functions.empty() ? std::string(" none") : enabled.str()));
+    }
+}
+} // namespace
+
+std::vector<BenchMethod> parseBenchMethods(const std::string& list)
+{
+    std::vector<BenchMethod> methods;
+    if (list == "all")
+    {
+        for (size_t method = 0; method < methodNames.size(); ++method)
+        {
+            methods.push_back(static_cast<BenchMethod>(method));
+        }
+        return methods;
+    }
+
+    std::istringstream names(list);
+    std::string name;
+    while (std::getline(names, name, ','))
+    {
+        const auto found =
+            std::find(methodNames.begin(), methodNames.end(), name);
+        if (found == methodNames.end())
+        {
+            throw std::runtime_error("Unknown method " + name);
+        }
+        methods.push_back(
+            static_cast<BenchMethod>(found - methodNames.begin()));
+    }
+
+    if (methods.empty())
+    {
+        throw std::runtime_error("No method to benchmark");
+    }
+    return methods;
+}
+
+void runBench(const BenchConfig& config)
+{
+    if (std::find(config.methods.begin(), config.methods.end(),
+                  BenchMethod::EXECUTE_FUNCTION) != config.methods.end())
+    {
+        checkFunctionEnabled(config);
+    }
+
+    std::atomic<uint32_t> nextCall{0};
+    ButtonPresses presses;
+    std::vector<WorkerResult> results(std::max<uint32_t>(config.concurrency,
+                                                         1));
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (auto& result : results)
+    {
+        workers.emplace_back([&config, &nextCall, &presses, &result,
+                              start]() {
+            try
+            {
+                auto bus = openBus(config.address);
+                for (auto call = nextCall++; call < config.calls;
+                     call = nextCall++)
+                {
+                    if (config.rate != 0)
+                    {
+                        std::this_thread::sleep_until(
+                            start + std::chrono::microseconds(
+                                        uint64_t{1000000} * call /
+                                        config.rate));
+                    }
+
+                    const auto method =
+                        config.methods[call % config.methods.size()];
+                    const auto callStart = std::chrono::steady_clock::now();
+                    try
+                    {
+                        callMethod(bus, method, call, config, presses);
+                    }
+                    catch (const std::exception&)
+                    {
+                        ++result.failures[static_cast<size_t>(method)];
+                        continue;
+                    }
+                    result.samples[static_cast<size_t>(method)].push_back(
+                        std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - callStart));
+                }
+            }
+            catch (const std::exception&)
+            {
+                result.error = std::current_exception();
+            }
+        });
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::array<MethodCalls, methodNames.size()> calls;
+    uint32_t failures = 0;
+    for (auto& result : results)
+    {
+        if (result.error)
+        {
+            std::rethrow_exception(result.error);
+        }
+        for (size_t method = 0; method < calls.size(); ++method)
+        {
+            calls[method].samples.insert(calls[method].samples.end(),
+                                         result.samples[method].begin(),
+                                         result.samples[method].end());
+            calls[method].failures += result.failures[method];
+            failures += result.failures[method];
+        }
+    }
+
+    const auto seconds = std::chrono::duration<double>(elapsed).count();
+    std::cout << "Calls: " << config.calls << ", failed: " << failures
+              << ", workers: " << results.size() << ", elapsed: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(
+                     elapsed)
+                     .count()
+              << " ms, throughput: "
+              << static_cast<uint64_t>(config.calls / seconds)
+              << " calls/s" << std::endl;
+
+    std::vector<MethodCalls> report;
+    for (size_t method = 0; method < calls.size(); ++method)
+    {
+        if (std::find(config.methods.begin(), config.methods.end(),
+                      static_cast<BenchMethod>(method)) !=
+            config.methods.end())
+        {
+            calls[method].method = methodNames[method];
+            report.push_back(std::move(calls[method]));
+        }
+    }
+    printLatencyReport(std::move(report));
+
+    // Move the panel back to the function it started at.
+    const auto offset = presses.offset.load();
+    if (offset != 0)
+    {
+        auto bus = openBus(config.address);
+        for (auto press = std::abs(offset); press > 0; --press)
+        {
+            btnEventDbusCall(bus, offset > 0 ? types::ButtonEvent::DECREMENT
+                                             : types::ButtonEvent::INCREMENT);
+        }
+    }
+}
+
+} // namespace tool
+} // namespace panel
@@ -0,0 +1,72 @@
+#include "button_script.hpp"
+
+#include "dbus_call.hpp"
+#include "latency_report.hpp"
+
+#include <charconv>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace panel
+{
+namespace tool
+{
+std::vector<types::ButtonEvent> parseButtonScript(std::istream& script)
+{
+    std::vector<types::ButtonEvent> events;
+    std::string line;
+    while (std::getline(script, line))
+    {
+        line = line.substr(0, line.find('#'));
+        std::istringstream words(line);
+        std::string word;
+        while (words >> word)
+        {
+            const auto star = word.find('*');
+            const auto event = toButtonEvent(word.substr(0, star));
+
+            size_t count = 1;
+            if (star != std::string::npos)
+            {
+                const auto repeat = word.substr(star + 1);
+                const auto [end, ec] = std::from_chars(
+                    repeat.data(), repeat.data() + repeat.size(), count);
+                if (ec != std::errc() ||
+                    end != repeat.data() + repeat.size() || count == 0)
+                {
+                    throw std::runtime_error("Invalid repeat count in " +
+                                             word);
+                }
+            }
+            events.insert(events.end(), count, event);
+        }
+    }
+    return events;
+}
+
+void runButtonScript(sdbusplus::bus_t& bus,
+                     const std::vector<types::ButtonEvent>& events,
+                     const std::chrono::milliseconds wait)
+{
+    LatencySamples samples;
+    samples.reserve(events.size());
+    for (const auto event : events)
+    {
+        if (!samples.empty() && wait.count() > 0)
+        {
+            std::this_thread::sleep_for(wait);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        btnEventDbusCall(bus, event);
+        samples.push_back(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start));
+    }
+    printLatencyReport({{"ProcessButton", std::move(samples)}});
+}
+
+} // namespace tool
+} // namespace panel
@@ -2,6 +2,11 @@
 
 #include "types.hpp"
 
+#include <systemd/sd-bus.h>
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
 #include <sdbusplus/bus.hpp>
 #include <sdbusplus/exception.hpp>
 
@@ -9,33 +14,135 @@ namespace panel
 {
 namespace tool
 {
-void btnEventDbusCall(const std::string& input)
+sdbusplus::bus_t openBus(const std::string& address)
+{
+    if (address.empty())
+    {
+        return sdbusplus::bus::new_default_system();
+    }
+
+    sd_bus* bus = nullptr;
+    auto rc = sd_bus_new(&bus);
+    if (rc >= 0)
+    {
+        rc = sd_bus_set_address(bus, address.c_str());
+    }
+    if (rc >= 0)
+    {
+        rc = sd_bus_set_bus_client(bus, 1);
+    }
+    if (rc >= 0)
+    {
+        rc = sd_bus_start(bus);
+    }
+    if (rc < 0)
+    {
+        sd_bus_unref(bus);
+        throw std::runtime_error("Can't connect to bus " + address + ": " +
+                                 std::strerror(-rc));
+    }
+
+    // The connection takes the reference.
+    return sdbusplus::bus_t(bus, std::false_type());
+}
+
+types::ButtonEvent toButtonEvent(const std::string& input)
 {
-    auto param = -1;
     if ((input.compare("DOWN")) == 0)
     {
-        param = types::ButtonEvent::DECREMENT;
+        return types::ButtonEvent::DECREMENT;
     }
     else if ((input.compare("UP")) == 0)
     {
-        param = types::ButtonEvent::INCREMENT;
+        return types::ButtonEvent::INCREMENT;
     }
     else if ((input.compare("EXECUTE")) == 0)
     {
-        param = types::ButtonEvent::EXECUTE;
-    }
-    else
-    {
-        throw std::runtime_error("Invalid Input");
+        return types::ButtonEvent::EXECUTE;
     }
+    throw std::runtime_error("Invalid Input");
+}
 
-    auto bus = sdbusplus::bus::new_default_system();
+void btnEventDbusCall(sdbusplus::bus_t& bus, const types::ButtonEvent event)
+{
     auto method = bus.new_method_call("com.ibm.PanelApp", "/com/ibm/panel_app",
                                       "com.ibm.panel", "ProcessButton");
-    method.append(param);
+    method.append(static_cast<int>(event));
+    try
+    {
+        bus.call(method);
+    }
+    catch (const sdbusplus::exception::SdBusError& e)
+    {
+        std::cerr << "SDBUS call failed: " << e.what();
+        throw;
+    }
+}
+
+void printFunctionTelemetry(sdbusplus::bus_t& bus)
+{
+    auto method =
+        bus.new_method_call("com.ibm.PanelApp", "/com/ibm/panel_app",
+                            "com.ibm.panel.Telemetry", "getFunctionStatistics");
+
+    types::FunctionStatistics statistics;
     try
     {
         auto reply = bus.call(method);
+        reply.read(statistics);
+    }
+    catch (const sdbusplus::exception::SdBusError& e)
+    {
+        std::cerr << "SDBUS call failed: " << e.what();
+        throw;
+    }
+
+    std::cout << std::left << std::setw(10) << "Function" << std::right
+              << std::setw(10) << "Success" << std::setw(10) << "Failure"
+              << std::setw(12) << "p50(us)" << std::setw(12) << "p99(us)"
+              << std::setw(12) << "max(us)" << "  Last error" << std::endl;
+
+    for (const auto& [funcNumber, entry] : statistics)
+    {
+        const auto& [success, failure, p50, p99, max, lastError] = entry;
+        std::cout << std::left << std::setw(10) << static_cast<int>(funcNumber)
+                  << std::right << std::setw(10) << success << std::setw(10)
+                  << failure << std::setw(12) << p50 << std::setw(12) << p99
+                  << std::setw(12) << max << "  " << lastError << std::endl;
+    }
+
+    auto progressMethod = bus.new_method_call(
+        "com.ibm.PanelApp", "/com/ibm/panel_app", "com.ibm.panel.Telemetry",
+        "getProgressCodeStatistics");
+
+    types::ProgressCodeStatistics progressCodes;
+    try
+    {
+        auto reply = bus.call(progressMethod);
+        reply.read(progressCodes);
+    }
+    catch (const sdbusplus::exception::SdBusError& e)
+    {
+        std::cerr << "SDBUS call failed: " << e.what();
+        throw;
+    }
+
+    std::cout << std::endl
+              << "Progress codes of the boot received: "
+              << std::get<0>(progressCodes)
+              << ", displayed: " << std::get<1>(progressCodes) << std::endl;
+}
+
+std::string dumpLogsDbusCall(sdbusplus::bus_t& bus)
+{
+    auto method =
+        bus.new_method_call("com.ibm.PanelApp", "/com/ibm/panel_app",
+                            "com.ibm.panel.Logging", "dumpLogs");
+    try
+    {
+        std::string path;
+        bus.call(method).read(path);
+        return path;
     }
     catch (const sdbusplus::exception::SdBusError& e)
     {
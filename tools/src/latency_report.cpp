@@ -0,0 +1,42 @@
+#include "latency_report.hpp"
+
+#include "latency_summary.hpp"
+
+#include <iomanip>
+#include <iostream>
+
+namespace panel
+{
+namespace tool
+{
+void printLatencyReport(std::vector<MethodCalls> methods)
+{
+    std::cout << std::left << std::setw(24) << "Method" << std::right
+              << std::setw(8) << "Calls" << std::setw(8) << "Failed"
+              << std::setw(12) << "mean(us)"
+              << std::setw(12) << "min(us)" << std::setw(12) << "p50(us)"
+              << std::setw(12) << "p90(us)" << std::setw(12) << "p99(us)"
+              << std::setw(12) << "max(us)" << std::endl;
+
+    for (auto& [method, samples, failures] : methods)
+    {
+        std::cout << std::left << std::setw(24) << method << std::right
+                  << std::setw(8) << samples.size() << std::setw(8)
+                  << failures;
+        if (samples.empty())
+        {
+            std::cout << std::endl;
+            continue;
+        }
+
+        const auto summary = summarizeLatency(std::span(samples));
+        std::cout << std::setw(12) << summary.mean << std::setw(12)
+                  << summary.min << std::setw(12) << summary.p50
+                  << std::setw(12) << summary.p90 << std::setw(12)
+                  << summary.p99 << std::setw(12) << summary.max
+                  << std::endl;
+    }
+}
+
+} // namespace tool
+} // namespace panel
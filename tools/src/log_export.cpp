@@ -0,0 +1,31 @@
+#include "log_export.hpp"
+
+#include "log_record.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+namespace panel
+{
+namespace tool
+{
+void printLogDump(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Log dump file can't be read");
+    }
+
+    const std::vector<uint8_t> dump(std::istreambuf_iterator<char>(file), {});
+    for (const auto& line : Logger::decodeDump(dump))
+    {
+        std::cout << line << std::endl;
+    }
+}
+
+} // namespace tool
+} // namespace panel
@@ -1,6 +1,12 @@
+#include "bus_bench.hpp"
+#include "button_script.hpp"
+#include "const.hpp"
 #include "dbus_call.hpp"
+#include "log_export.hpp"
+#include "timeline_export.hpp"
 
 #include <CLI/CLI.hpp>
+#include <fstream>
 #include <iostream>
 
 int main(int argc, char** argv)
@@ -11,13 +17,101 @@ int main(int argc, char** argv)
         " -b", input,
         " Simulating button press"
         " Increment/Decrement/Execute with UP/DOWN/EXECUTE respectively");
+    auto telemetry = app.add_subcommand(
+        "telemetry", "Print execution latency and outcome of panel functions");
+    auto timeline = app.add_subcommand(
+        "timeline", "Export the progress code phases of a boot as CSV");
+    uint32_t boot = 0;
+    auto bootOption = timeline->add_option(
+        "--boot", boot, "Boot to export, the latest boot by default");
+    auto log = app.add_subcommand(
+        "log", "Dump the logs of the panel app and print them as text");
+    std::string logFile{};
+    auto fileOption = log->add_option(
+        "--file", logFile, "Log dump to print instead of a new dump");
+    auto script = app.add_subcommand(
+        "script", "Send a sequence of button events, e.g. \"UP*5 EXECUTE "
+                  "DOWN\", and print the round trip latency of the calls");
+    std::string scriptFile{};
+    auto scriptOption = script->add_option(
+        "--file", scriptFile, "Script to run, standard input by default");
+    uint32_t waitMs = 0;
+    script->add_option("--wait", waitMs,
+                       "Time to wait between events in ms, 0 by default");
+    auto bench = app.add_subcommand(
+        "bench", "Benchmark the com.ibm.panel D-Bus methods of the panel app");
+    panel::tool::BenchConfig benchConfig;
+    std::string benchMethods = "getEnabledFunctions";
+    bench->add_option("--methods", benchMethods,
+                      "Comma separated methods to call in turn: Display, "
+                      "ProcessButton, getEnabledFunctions, ExecuteFunction, "
+                      "or all. Display and ExecuteFunction change the panel "
+                      "and the host, use them with --address. "
+                      "getEnabledFunctions by default");
+    bench->add_option("--calls", benchConfig.calls,
+                      "Number of calls, 1000 by default");
+    bench->add_option("--rate", benchConfig.rate,
+                      "Calls per second, no limit by default");
+    bench->add_option("--concurrency", benchConfig.concurrency,
+                      "Number of concurrent callers, 1 by default");
+    bench->add_option("--function", benchConfig.function,
+                      "Function run by ExecuteFunction, one of the functions "
+                      "returned by getEnabledFunctions. 21 by default");
+    bench->add_option("--address", benchConfig.address,
+                      "D-Bus address of a private bus, e.g. of a panel app "
+                      "run with --emulate. System bus by default");
     CLI11_PARSE(app, argc, argv);
 
     try
     {
         if (*state)
         {
-            panel::tool::btnEventDbusCall(input);
+            auto bus = sdbusplus::bus::new_default_system();
+            panel::tool::btnEventDbusCall(bus,
+                                          panel::tool::toButtonEvent(input));
+        }
+        else if (*telemetry)
+        {
+            auto bus = sdbusplus::bus::new_default_system();
+            panel::tool::printFunctionTelemetry(bus);
+        }
+        else if (*script)
+        {
+            std::ifstream file;
+            if (*scriptOption)
+            {
+                file.open(scriptFile);
+                if (!file.is_open())
+                {
+                    throw std::runtime_error("Script file can't be read");
+                }
+            }
+            const auto events = panel::tool::parseButtonScript(
+                *scriptOption ? file : std::cin);
+
+            auto bus = sdbusplus::bus::new_default_system();
+            panel::tool::runButtonScript(bus, events,
+                                         std::chrono::milliseconds(waitMs));
+        }
+        else if (*bench)
+        {
+            benchConfig.methods = panel::tool::parseBenchMethods(benchMethods);
+            panel::tool::runBench(benchConfig);
+        }
+        else if (*timeline)
+        {
+            panel::tool::exportBootTimeline(
+                panel::constants::timelineFilePath,
+                *bootOption ? std::optional<uint32_t>(boot) : std::nullopt);
+        }
+        else if (*log)
+        {
+            if (!*fileOption)
+            {
+                auto bus = sdbusplus::bus::new_default_system();
+                logFile = panel::tool::dumpLogsDbusCall(bus);
+            }
+            panel::tool::printLogDump(logFile);
         }
         else
         {
@@ -0,0 +1,63 @@
+#include "timeline_export.hpp"
+
+#include "progress_timeline.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+namespace panel
+{
+namespace tool
+{
+void exportBootTimeline(const std::string& path,
+                        const std::optional<uint32_t>& boot)
+{
+    timeline::Timeline bootTimeline;
+    if (!bootTimeline.open(path, true))
+    {
+        throw std::runtime_error("Timeline file can't be read");
+    }
+
+    const auto bootNumber = boot.value_or(bootTimeline.currentBoot());
+
+    std::vector<timeline::Entry> entries;
+    for (size_t pos = 0; pos < bootTimeline.size(); ++pos)
+    {
+        const auto entry = bootTimeline.at(pos);
+        if (entry.boot == bootNumber)
+        {
+            entries.push_back(entry);
+        }
+    }
+
+    if (entries.empty())
+    {
+        throw std::runtime_error("No progress code recorded for boot " +
+                                 std::to_string(bootNumber));
+    }
+
+    const auto toMs = [](const uint64_t nanoseconds) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::nanoseconds(nanoseconds))
+            .count();
+    };
+
+    std::cout << "boot,src,start_ms,duration_ms" << std::endl;
+    for (size_t pos = 0; pos < entries.size(); ++pos)
+    {
+        std::cout << bootNumber << ","
+                  << entries[pos].toSrcRecord().getSrc() << ","
+                  << toMs(entries[pos].timestamp - entries[0].timestamp)
+                  << ",";
+        if (pos + 1 < entries.size())
+        {
+            std::cout << toMs(entries[pos + 1].timestamp -
+                              entries[pos].timestamp);
+        }
+        std::cout << std::endl;
+    }
+}
+} // namespace tool
+} // namespace panel